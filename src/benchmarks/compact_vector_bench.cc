@@ -0,0 +1,65 @@
+#include "../s21_compact_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+
+// Builds a graph as one adjacency list per vertex, degrees 0..7 like a sparse
+// social graph, then sums the neighbours. Reports the bytes per list: the
+// vector objects plus their heap blocks.
+template <typename List>
+void adjacency(benchmark::State &state, std::size_t heap_bytes_per_list(const List &))
+{
+  std::size_t vertices = state.range(0);
+  double bytes_per_list = 0;
+  for (auto _ : state) {
+    s21::s21_vector<List> graph(vertices);
+    for (std::size_t v = 0; v < vertices; ++v) {
+      std::size_t degree = (v * 2654435761u >> 7) % 8;
+      for (std::size_t e = 0; e < degree; ++e) {
+        graph[v].push_back(static_cast<uint32_t>((v + e * 7919) % vertices));
+      }
+    }
+    uint64_t sum = 0;
+    std::size_t heap = 0;
+    for (const List &list : graph) {
+      for (uint32_t neighbour : list) {
+        sum += neighbour;
+      }
+      heap += heap_bytes_per_list(list);
+    }
+    benchmark::DoNotOptimize(sum);
+    bytes_per_list = static_cast<double>(sizeof(List) + heap / vertices);
+  }
+  state.counters["bytes_per_list"] = bytes_per_list;
+  state.SetItemsProcessed(state.iterations() * vertices);
+}
+
+void BM_AdjacencyVector(benchmark::State &state)
+{
+  adjacency<s21::s21_vector<uint32_t>>(state, [](const s21::s21_vector<uint32_t> &list) {
+    return list.capacity() * sizeof(uint32_t);
+  });
+}
+
+void BM_AdjacencyCompactVector(benchmark::State &state)
+{
+  adjacency<s21::compact_vector<uint32_t>>(state, [](const s21::compact_vector<uint32_t> &list) {
+    return list.capacity() * sizeof(uint32_t);
+  });
+}
+
+void BM_AdjacencyThinVector(benchmark::State &state)
+{
+  adjacency<s21::thin_vector<uint32_t>>(state, [](const s21::thin_vector<uint32_t> &list) {
+    return s21::thin_vector<uint32_t>::block_bytes(list.capacity());
+  });
+}
+
+}  // namespace
+
+BENCHMARK(BM_AdjacencyVector)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_AdjacencyCompactVector)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_AdjacencyThinVector)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,90 @@
+#include "../s21_concurrent_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <mutex>
+
+namespace {
+
+// Every thread appends kAppends records to one shared table per iteration; the
+// table is created by thread 0 before the timed loop and destroyed after it.
+constexpr uint64_t kAppends = 1 << 14;
+
+s21::concurrent_vector<uint64_t> *g_concurrent = nullptr;
+s21::s21_vector<uint64_t> *g_locked = nullptr;
+std::mutex g_mutex;
+
+void BM_ConcurrentPushBack(benchmark::State &state)
+{
+  if (state.thread_index() == 0) {
+    g_concurrent = new s21::concurrent_vector<uint64_t>;
+  }
+  for (auto _ : state) {
+    for (uint64_t i = 0; i < kAppends; ++i) {
+      g_concurrent->push_back(i);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kAppends);
+  if (state.thread_index() == 0) {
+    delete g_concurrent;
+  }
+}
+
+void BM_MutexPushBack(benchmark::State &state)
+{
+  if (state.thread_index() == 0) {
+    g_locked = new s21::s21_vector<uint64_t>;
+  }
+  for (auto _ : state) {
+    for (uint64_t i = 0; i < kAppends; ++i) {
+      std::lock_guard<std::mutex> lock(g_mutex);
+      g_locked->push_back(i);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kAppends);
+  if (state.thread_index() == 0) {
+    delete g_locked;
+  }
+}
+
+// appends in batches of 64, one claim (or one lock) per batch
+void BM_ConcurrentGrowBy(benchmark::State &state)
+{
+  if (state.thread_index() == 0) {
+    g_concurrent = new s21::concurrent_vector<uint64_t>;
+  }
+  for (auto _ : state) {
+    for (uint64_t i = 0; i < kAppends; i += 64) {
+      g_concurrent->grow_by(64, i);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kAppends);
+  if (state.thread_index() == 0) {
+    delete g_concurrent;
+  }
+}
+
+void BM_MutexGrowBy(benchmark::State &state)
+{
+  if (state.thread_index() == 0) {
+    g_locked = new s21::s21_vector<uint64_t>;
+  }
+  for (auto _ : state) {
+    for (uint64_t i = 0; i < kAppends; i += 64) {
+      std::lock_guard<std::mutex> lock(g_mutex);
+      g_locked->insert(g_locked->cend(), 64, i);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kAppends);
+  if (state.thread_index() == 0) {
+    delete g_locked;
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_ConcurrentPushBack)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_MutexPushBack)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ConcurrentGrowBy)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_MutexGrowBy)->ThreadRange(1, 8)->UseRealTime();
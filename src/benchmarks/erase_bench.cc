@@ -0,0 +1,83 @@
+#include "../s21_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <string>
+
+namespace {
+
+// a cache entry with an owning member, so moves are not free
+struct Entry
+{
+  int64_t expires;
+  std::string key;
+};
+
+s21::s21_vector<Entry> make_entries(size_t count)
+{
+  s21::s21_vector<Entry> entries;
+  entries.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    entries.push_back(Entry{static_cast<int64_t>((i * 2654435761u) % 1000), "key" + std::to_string(i)});
+  }
+  return entries;
+}
+
+// the sweep as it was written before: erase(pos) for every expired entry
+void BM_ExpiryEraseInLoop(benchmark::State &state)
+{
+  s21::s21_vector<Entry> source = make_entries(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::s21_vector<Entry> entries(source);
+    state.ResumeTiming();
+    for (size_t i = 0; i < entries.size();) {
+      if (entries[i].expires < 100) {
+        entries.erase(entries.cbegin() + i);
+      } else {
+          ++i;
+      }
+    }
+    benchmark::DoNotOptimize(entries.size());
+  }
+  state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+void BM_ExpiryEraseIf(benchmark::State &state)
+{
+  s21::s21_vector<Entry> source = make_entries(state.range(0));
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::s21_vector<Entry> entries(source);
+    state.ResumeTiming();
+    s21::erase_if(entries, [](const Entry &entry) { return entry.expires < 100; });
+    benchmark::DoNotOptimize(entries.size());
+  }
+  state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+void BM_ExpiryEraseIndices(benchmark::State &state)
+{
+  s21::s21_vector<Entry> source = make_entries(state.range(0));
+  s21::s21_vector<size_t> expired;
+  for (size_t i = 0; i < source.size(); ++i) {
+    if (source[i].expires < 100) {
+      expired.push_back(i);
+    }
+  }
+  for (auto _ : state) {
+    state.PauseTiming();
+    s21::s21_vector<Entry> entries(source);
+    state.ResumeTiming();
+    s21::erase_indices(entries, expired);
+    benchmark::DoNotOptimize(entries.size());
+  }
+  state.SetItemsProcessed(state.iterations() * source.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ExpiryEraseInLoop)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_ExpiryEraseIf)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_ExpiryEraseIndices)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,132 @@
+#include "../s21_flat_map.h"
+#include "../s21_map.h"
+#include "../s21_set.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+
+// keys spread over a wider range than count, so about half the lookups miss
+s21::s21_vector<int> make_keys(size_t count, unsigned seed)
+{
+  s21::s21_vector<int> keys(count);
+  for (size_t i = 0; i < count; ++i) {
+    seed = seed * 1103515245 + 12345;
+    keys[i] = static_cast<int>(seed % (2 * count));
+  }
+  return keys;
+}
+
+void BM_SetLookup(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<int> keys = make_keys(count, 1);
+  s21::Set<int> set;
+  for (int key : keys) {
+    set.insert(key);
+  }
+  s21::s21_vector<int> probes = make_keys(4096, 2);
+  for (auto _ : state) {
+    size_t found = 0;
+    for (int probe : probes) {
+      found += set.contains(probe);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+void BM_FlatSetLookup(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<int> keys = make_keys(count, 1);
+  s21::flat_set<int> set(keys.begin(), keys.end());
+  s21::s21_vector<int> probes = make_keys(4096, 2);
+  for (auto _ : state) {
+    size_t found = 0;
+    for (int probe : probes) {
+      found += set.contains(probe);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+void BM_MapLookup(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<int> keys = make_keys(count, 1);
+  s21::Map<int, int64_t> map;
+  for (int key : keys) {
+    map.insert(key, key);
+  }
+  s21::s21_vector<int> probes = make_keys(4096, 2);
+  for (auto _ : state) {
+    int64_t total = 0;
+    for (int probe : probes) {
+      if (map.contains(probe)) {
+        total += map[probe];
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+void BM_FlatMapLookup(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<int> keys = make_keys(count, 1);
+  s21::s21_vector<std::pair<int, int64_t>> pairs;
+  for (int key : keys) {
+    pairs.push_back({key, key});
+  }
+  s21::flat_map<int, int64_t> map(pairs.begin(), pairs.end());
+  s21::s21_vector<int> probes = make_keys(4096, 2);
+  for (auto _ : state) {
+    int64_t total = 0;
+    for (int probe : probes) {
+      auto it = map.find(probe);
+      if (it != map.end()) {
+        total += it->second;
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * probes.size());
+}
+
+// the hourly rebuild: tree inserts one node at a time, flat_set sorts once
+void BM_SetBuild(benchmark::State &state)
+{
+  s21::s21_vector<int> keys = make_keys(state.range(0), 1);
+  for (auto _ : state) {
+    s21::Set<int> set;
+    for (int key : keys) {
+      set.insert(key);
+    }
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+void BM_FlatSetBuild(benchmark::State &state)
+{
+  s21::s21_vector<int> keys = make_keys(state.range(0), 1);
+  for (auto _ : state) {
+    s21::flat_set<int> set(keys.begin(), keys.end());
+    benchmark::DoNotOptimize(set.size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+}  // namespace
+
+BENCHMARK(BM_SetLookup)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_FlatSetLookup)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_MapLookup)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_FlatMapLookup)->Range(1 << 10, 1 << 18);
+BENCHMARK(BM_SetBuild)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_FlatSetBuild)->Range(1 << 10, 1 << 16);
@@ -0,0 +1,84 @@
+#include "../s21_gap_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+
+// One step of an editing session: the cursor moves, then a character is typed
+// or deleted there. Most steps stay within a few characters of the previous
+// one; one in 64 jumps somewhere else in the document.
+struct Edit
+{
+  std::size_t cursor;
+  bool erase;
+};
+
+s21::s21_vector<Edit> make_trace(std::size_t document, std::size_t edits)
+{
+  s21::s21_vector<Edit> trace;
+  trace.reserve(edits);
+  std::size_t size = document;
+  std::size_t cursor = document / 2;
+  uint64_t state = 88172645463325252ull;
+  for (std::size_t i = 0; i < edits; ++i) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    if (state % 64 == 0) {
+      cursor = (state >> 8) % (size + 1);
+    } else {
+        std::size_t step = (state >> 8) % 5;
+        cursor = step < 2 && cursor >= step ? cursor - step : cursor + (step - 2);
+        cursor = cursor > size ? size : cursor;
+    }
+    bool erase = (state >> 16) % 4 == 0 && cursor > 0;
+    if (erase) {
+      --cursor;
+      --size;
+    }
+    trace.push_back(Edit{cursor, erase});
+    if (!erase) {
+      ++cursor;
+      ++size;
+    }
+  }
+  return trace;
+}
+
+template <typename Buffer>
+void replay(benchmark::State &state)
+{
+  std::size_t document = state.range(0);
+  s21::s21_vector<Edit> trace = make_trace(document, 1 << 14);
+  for (auto _ : state) {
+    state.PauseTiming();
+    Buffer text(document, 'x');
+    state.ResumeTiming();
+    for (const Edit &edit : trace) {
+      if (edit.erase) {
+        text.erase(text.cbegin() + edit.cursor);
+      } else {
+          text.insert(text.cbegin() + edit.cursor, 'y');
+      }
+    }
+    benchmark::DoNotOptimize(text.size());
+  }
+  state.SetItemsProcessed(state.iterations() * trace.size());
+}
+
+void BM_EditTraceVector(benchmark::State &state)
+{
+  replay<s21::s21_vector<char>>(state);
+}
+
+void BM_EditTraceGapVector(benchmark::State &state)
+{
+  replay<s21::gap_vector<char>>(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_EditTraceVector)->Range(1 << 10, 1 << 20);
+BENCHMARK(BM_EditTraceGapVector)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,57 @@
+#include "../s21_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+
+// push_back throughput and how much of the final buffer is unused, per growth policy
+template <typename Policy>
+void BM_PushBack(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  size_t capacity = 0;
+  for (auto _ : state) {
+    s21::s21_vector<uint64_t, std::allocator<uint64_t>, Policy> v;
+    for (size_t i = 0; i < count; ++i) {
+      v.push_back(i);
+    }
+    benchmark::DoNotOptimize(v.data());
+    capacity = v.capacity();
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  state.counters["capacity"] = capacity;
+  state.counters["unused_%"] = 100.0 * (capacity - count) / capacity;
+}
+
+// unused share averaged over every size from 1 to range(0): what a table of random sizes wastes
+template <typename Policy>
+void BM_AverageOverhead(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  double unused = 0;
+  for (auto _ : state) {
+    s21::s21_vector<uint64_t, std::allocator<uint64_t>, Policy> v;
+    unused = 0;
+    for (size_t i = 0; i < count; ++i) {
+      v.push_back(i);
+      unused += double(v.capacity() - v.size()) / v.capacity();
+    }
+    benchmark::DoNotOptimize(v.data());
+  }
+  state.counters["avg_unused_%"] = 100.0 * unused / count;
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_PushBack, s21::growth::doubling<>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_PushBack, s21::growth::one_and_half<>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_PushBack, s21::growth::doubling<16>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_PushBack, s21::growth::size_class<>)->Range(1 << 10, 1 << 22);
+BENCHMARK_TEMPLATE(BM_PushBack, s21::growth::size_class<s21::growth::one_and_half<>>)->Range(1 << 10, 1 << 22);
+
+BENCHMARK_TEMPLATE(BM_AverageOverhead, s21::growth::doubling<>)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_AverageOverhead, s21::growth::one_and_half<>)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_AverageOverhead, s21::growth::size_class<>)->Arg(1 << 20);
+BENCHMARK_TEMPLATE(BM_AverageOverhead, s21::growth::size_class<s21::growth::one_and_half<>>)->Arg(1 << 20);
@@ -0,0 +1,54 @@
+#include "../s21_incremental_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+namespace {
+
+// Times every single push_back into an empty vector and reports the tail of
+// that distribution. With s21_vector the pushes that hit capacity relocate the
+// whole vector and dominate p99.9 and max; incremental_vector spreads that
+// work over the pushes that follow.
+template <typename Vector>
+void push_latency(benchmark::State &state)
+{
+  std::size_t count = state.range(0);
+  s21::s21_vector<int64_t> latencies(count);
+  double p50 = 0, p999 = 0, worst = 0;
+  for (auto _ : state) {
+    Vector v;
+    for (std::size_t i = 0; i < count; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      v.push_back(static_cast<int64_t>(i));
+      auto stop = std::chrono::steady_clock::now();
+      latencies[i] = std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count();
+    }
+    benchmark::DoNotOptimize(v.back());
+    std::sort(latencies.begin(), latencies.end());
+    p50 = static_cast<double>(latencies[count / 2]);
+    p999 = static_cast<double>(latencies[count - 1 - count / 1000]);
+    worst = static_cast<double>(latencies[count - 1]);
+  }
+  state.counters["p50_ns"] = p50;
+  state.counters["p99.9_ns"] = p999;
+  state.counters["max_ns"] = worst;
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+void BM_PushLatencyDoubling(benchmark::State &state)
+{
+  push_latency<s21::s21_vector<int64_t>>(state);
+}
+
+void BM_PushLatencyIncremental(benchmark::State &state)
+{
+  push_latency<s21::incremental_vector<int64_t>>(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_PushLatencyDoubling)->Range(1 << 16, 1 << 24)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_PushLatencyIncremental)->Range(1 << 16, 1 << 24)->Unit(benchmark::kMillisecond);
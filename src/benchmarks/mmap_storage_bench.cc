@@ -0,0 +1,62 @@
+#include "../s21_mmap_allocator.h"
+#include "../s21_vector.h"
+
+#include <benchmark/benchmark.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+
+namespace {
+
+// Grows a vector to range(0) MiB of uint64_t in a forked child, so the child's
+// ru_maxrss is the peak RSS of that growth alone and not of the whole run.
+template <typename Vector>
+void BM_GrowthPeakRss(benchmark::State &state)
+{
+  const size_t count = (size_t(state.range(0)) << 20) / sizeof(uint64_t);
+  double peak_mb = 0;
+  for (auto _ : state) {
+    int channel[2];
+    if (pipe(channel) != 0) {
+      state.SkipWithError("pipe failed");
+      break;
+    }
+    pid_t child = fork();
+    if (child == 0) {
+      auto start = std::chrono::steady_clock::now();
+      Vector v;
+      for (size_t i = 0; i < count; ++i) {
+        v.push_back(i);
+      }
+      benchmark::DoNotOptimize(v.data());
+      double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      ssize_t written = write(channel[1], &seconds, sizeof(seconds));
+      _exit(written == sizeof(seconds) ? 0 : 1);
+    }
+    close(channel[1]);
+    double seconds = 0;
+    ssize_t got = read(channel[0], &seconds, sizeof(seconds));
+    close(channel[0]);
+    int status = 0;
+    struct rusage usage;
+    wait4(child, &status, 0, &usage);
+    if (got != sizeof(seconds) || status != 0) {
+      state.SkipWithError("child failed");
+      break;
+    }
+    state.SetIterationTime(seconds);
+    peak_mb = usage.ru_maxrss / 1024.0;
+  }
+  state.counters["peak_rss_MB"] = peak_mb;
+  state.counters["data_MB"] = state.range(0);
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_GrowthPeakRss, s21::s21_vector<uint64_t>)
+    ->Arg(256)->Arg(1024)->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(3);
+BENCHMARK_TEMPLATE(BM_GrowthPeakRss, s21::mmap_vector<uint64_t>)
+    ->Arg(256)->Arg(1024)->UseManualTime()->Unit(benchmark::kMillisecond)->Iterations(3);
@@ -0,0 +1,74 @@
+#include "../s21_packed_int_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace {
+
+// sorted timestamps with small irregular gaps, as an event log would have them
+s21::s21_vector<uint64_t> make_timestamps(size_t count)
+{
+  s21::s21_vector<uint64_t> values;
+  values.reserve(count);
+  uint64_t now = 1700000000000;
+  for (size_t i = 0; i < count; ++i) {
+    now += 1 + (i * 2654435761u >> 8) % 50;
+    values.push_back(now);
+  }
+  return values;
+}
+
+void BM_ScanVector(benchmark::State &state)
+{
+  s21::s21_vector<uint64_t> values = make_timestamps(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::sum(values));
+  }
+  state.counters["bytes_per_value"] = static_cast<double>(values.capacity() * sizeof(uint64_t)) / values.size();
+  state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <s21::packing Mode>
+void scan_packed(benchmark::State &state)
+{
+  s21::packed_int_vector<uint64_t, Mode> packed(make_timestamps(state.range(0)));
+  packed.shrink_to_fit();
+  for (auto _ : state) {
+    uint64_t total = 0;
+    packed.for_each_block([&total](const uint64_t *block, size_t n) {
+      total += s21::simd::sum(block, block + n);
+    });
+    benchmark::DoNotOptimize(total);
+  }
+  state.counters["bytes_per_value"] = static_cast<double>(packed.memory_bytes()) / packed.size();
+  state.SetItemsProcessed(state.iterations() * packed.size());
+}
+
+void BM_ScanPackedFrame(benchmark::State &state)
+{
+  scan_packed<s21::packing::frame_of_reference>(state);
+}
+
+void BM_ScanPackedDelta(benchmark::State &state)
+{
+  scan_packed<s21::packing::delta>(state);
+}
+
+void BM_RandomAccessPackedFrame(benchmark::State &state)
+{
+  s21::packed_int_vector<uint64_t> packed(make_timestamps(state.range(0)));
+  size_t index = 0;
+  for (auto _ : state) {
+    index = (index * 6364136223846793005u + 1442695040888963407u) % packed.size();
+    benchmark::DoNotOptimize(packed[index]);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+BENCHMARK(BM_ScanVector)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_ScanPackedFrame)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_ScanPackedDelta)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_RandomAccessPackedFrame)->Range(1 << 12, 1 << 22);
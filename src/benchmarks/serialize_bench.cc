@@ -0,0 +1,93 @@
+#include "../s21_serialize.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <cstdint>
+
+namespace {
+
+struct Record
+{
+  int64_t id;
+  double price;
+  int32_t quantity;
+  char name[20];
+};
+
+s21::s21_vector<Record> make_records(size_t count)
+{
+  s21::s21_vector<Record> records(count);
+  for (size_t i = 0; i < count; ++i) {
+    records[i].id = static_cast<int64_t>(i);
+    records[i].price = double(i % 100);
+  }
+  return records;
+}
+
+// what callers did before: one write() per element, into a page-cache backed file
+void BM_WritePerElement(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<Record> records = make_records(count);
+  FILE *file = std::tmpfile();
+  int fd = fileno(file);
+  for (auto _ : state) {
+    lseek(fd, 0, SEEK_SET);
+    for (const Record &record : records) {
+      benchmark::DoNotOptimize(::write(fd, &record, sizeof(record)));
+    }
+  }
+  std::fclose(file);
+  state.SetBytesProcessed(state.iterations() * count * sizeof(Record));
+}
+
+void BM_SerializeWritev(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<Record> records = make_records(count);
+  FILE *file = std::tmpfile();
+  int fd = fileno(file);
+  for (auto _ : state) {
+    lseek(fd, 0, SEEK_SET);
+    s21::serialize(fd, records);
+  }
+  std::fclose(file);
+  state.SetBytesProcessed(state.iterations() * count * sizeof(Record));
+}
+
+void BM_DeserializeRead(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  FILE *file = std::tmpfile();
+  int fd = fileno(file);
+  s21::serialize(fd, make_records(count));
+  s21::s21_vector<Record> records;
+  for (auto _ : state) {
+    lseek(fd, 0, SEEK_SET);
+    s21::deserialize(fd, records);
+    benchmark::DoNotOptimize(records.data());
+  }
+  std::fclose(file);
+  state.SetBytesProcessed(state.iterations() * count * sizeof(Record));
+}
+
+// a record already in memory (shared memory, a received message): no copy at all
+void BM_SerialView(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::serial_buffer buffer;
+  s21::serialize(make_records(count), buffer);
+  for (auto _ : state) {
+    s21::serial_view<Record> view(buffer.data(), buffer.size());
+    benchmark::DoNotOptimize(view[count - 1].id);
+  }
+  state.SetBytesProcessed(state.iterations() * count * sizeof(Record));
+}
+
+}  // namespace
+
+BENCHMARK(BM_WritePerElement)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_SerializeWritev)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_DeserializeRead)->Range(1 << 10, 1 << 16);
+BENCHMARK(BM_SerialView)->Range(1 << 10, 1 << 16);
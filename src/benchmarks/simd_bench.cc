@@ -0,0 +1,147 @@
+#include "../s21_simd.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+namespace {
+
+// Every benchmark scans the whole vector: find and contains_any look for values that
+// are not there. The Std* variants are the iterator loops the kernels replace.
+template <typename T>
+s21::s21_vector<T> Fill(size_t count)
+{
+  s21::s21_vector<T> v(count);
+  for (size_t i = 0; i < count; ++i) {
+    v[i] = static_cast<T>(i % 1000);
+  }
+  return v;
+}
+
+template <typename T>
+void BM_StdFind(benchmark::State &state)
+{
+  auto v = Fill<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::find(v.cbegin(), v.cend(), static_cast<T>(-1)));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <typename T>
+void BM_SimdFind(benchmark::State &state)
+{
+  auto v = Fill<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::find(v, static_cast<T>(-1)));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <typename T>
+void BM_StdCount(benchmark::State &state)
+{
+  auto v = Fill<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::count(v.cbegin(), v.cend(), static_cast<T>(7)));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <typename T>
+void BM_SimdCount(benchmark::State &state)
+{
+  auto v = Fill<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::count(v, static_cast<T>(7)));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <typename T>
+void BM_StdMinmax(benchmark::State &state)
+{
+  auto v = Fill<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::minmax_element(v.cbegin(), v.cend()));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <typename T>
+void BM_SimdMinmax(benchmark::State &state)
+{
+  auto v = Fill<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::minmax(v));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <typename T>
+void BM_StdSum(benchmark::State &state)
+{
+  auto v = Fill<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::accumulate(v.cbegin(), v.cend(), s21::simd::sum_t<T>(0)));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <typename T>
+void BM_SimdSum(benchmark::State &state)
+{
+  auto v = Fill<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::sum(v));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <typename T>
+void BM_StdContainsAny(benchmark::State &state)
+{
+  auto v = Fill<T>(state.range(0));
+  const T needles[] = {static_cast<T>(-1), static_cast<T>(-2), static_cast<T>(-3)};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::find_first_of(v.cbegin(), v.cend(), needles, needles + 3));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+template <typename T>
+void BM_SimdContainsAny(benchmark::State &state)
+{
+  auto v = Fill<T>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(s21::simd::contains_any(v, {static_cast<T>(-1), static_cast<T>(-2), static_cast<T>(-3)}));
+  }
+  state.SetBytesProcessed(state.iterations() * v.size() * sizeof(T));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_StdFind, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdFind, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdFind, double)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdFind, double)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_TEMPLATE(BM_StdCount, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdCount, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdCount, int64_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdCount, int64_t)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_TEMPLATE(BM_StdMinmax, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdMinmax, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdMinmax, float)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdMinmax, float)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_TEMPLATE(BM_StdSum, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdSum, int32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_StdSum, float)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdSum, float)->Range(1 << 10, 1 << 20);
+
+BENCHMARK_TEMPLATE(BM_StdContainsAny, uint32_t)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_SimdContainsAny, uint32_t)->Range(1 << 10, 1 << 20);
@@ -0,0 +1,76 @@
+#include "../s21_soa_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+
+namespace {
+
+// A 64-byte record of which a scan reads one 8-byte field
+struct Record
+{
+  int64_t id;
+  double price;
+  int32_t quantity;
+  char name[44];
+};
+
+void BM_AosPriceScan(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<Record> records(count);
+  for (size_t i = 0; i < count; ++i) {
+    records[i].price = double(i % 100);
+  }
+  for (auto _ : state) {
+    double total = 0;
+    for (const Record &record : records) {
+      total += record.price;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+void BM_SoaPriceScan(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::soa_vector<int64_t, double, int32_t, std::array<char, 44>> records(count);
+  for (size_t i = 0; i < count; ++i) {
+    records.get<1>(i) = double(i % 100);
+  }
+  for (auto _ : state) {
+    double total = 0;
+    const double *price = records.data<1>();
+    for (size_t i = 0; i < count; ++i) {
+      total += price[i];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+// the same scan written row-wise through the proxy iterator
+void BM_SoaRowScan(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::soa_vector<int64_t, double, int32_t, std::array<char, 44>> records(count);
+  for (size_t i = 0; i < count; ++i) {
+    records.get<1>(i) = double(i % 100);
+  }
+  for (auto _ : state) {
+    double total = 0;
+    for (auto row : records) {
+      total += std::get<1>(row);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+}  // namespace
+
+BENCHMARK(BM_AosPriceScan)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_SoaPriceScan)->Range(1 << 12, 1 << 22);
+BENCHMARK(BM_SoaRowScan)->Range(1 << 12, 1 << 22);
@@ -0,0 +1,81 @@
+#include "../s21_vector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+// A sparse "visited" bitmap: one flag in 64 is set. The char vector is the one
+// byte per flag layout s21_vector<bool> had before it was bit-packed.
+constexpr size_t kStride = 64;
+
+void BM_CharCount(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<char> flags(count);
+  for (size_t i = 0; i < count; i += kStride) {
+    flags[i] = 1;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(std::count(flags.cbegin(), flags.cend(), 1));
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  state.counters["bytes"] = double(flags.capacity());
+}
+
+void BM_BitCount(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<bool> flags(count);
+  for (size_t i = 0; i < count; i += kStride) {
+    flags[i] = true;
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(flags.count());
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+  state.counters["bytes"] = double(flags.capacity() / 8);
+}
+
+void BM_CharVisitSet(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<char> flags(count);
+  for (size_t i = 0; i < count; i += kStride) {
+    flags[i] = 1;
+  }
+  for (auto _ : state) {
+    size_t sum = 0;
+    for (auto it = std::find(flags.cbegin(), flags.cend(), 1); it != flags.cend(); it = std::find(it + 1, flags.cend(), 1)) {
+      sum += size_t(it - flags.cbegin());
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+void BM_BitVisitSet(benchmark::State &state)
+{
+  const size_t count = state.range(0);
+  s21::s21_vector<bool> flags(count);
+  for (size_t i = 0; i < count; i += kStride) {
+    flags[i] = true;
+  }
+  for (auto _ : state) {
+    size_t sum = 0;
+    for (size_t i = flags.find_first(); i != flags.npos; i = flags.find_next(i)) {
+      sum += i;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * count);
+}
+
+}  // namespace
+
+BENCHMARK(BM_CharCount)->Range(1 << 16, 1 << 26);
+BENCHMARK(BM_BitCount)->Range(1 << 16, 1 << 26);
+BENCHMARK(BM_CharVisitSet)->Range(1 << 16, 1 << 26);
+BENCHMARK(BM_BitVisitSet)->Range(1 << 16, 1 << 26);
@@ -0,0 +1,62 @@
+#ifndef SRC_S21_ALIGNED_ALLOCATOR_H_
+#define SRC_S21_ALIGNED_ALLOCATOR_H_
+
+#include <cstddef>
+#include <new>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // Allocator whose buffers start on an Align-byte boundary, or on alignof(T) if
+  // that is stricter: 64 puts every buffer on its own cache line (no false
+  // sharing with whatever the heap put before it) and lets SIMD kernels use
+  // aligned loads from data(). std::allocator already honours alignof(T), so
+  // this is only needed for an alignment beyond what the element type asks for.
+  template <typename T, std::size_t Align = 64>
+  class aligned_allocator
+  {
+    static_assert(Align && (Align & (Align - 1)) == 0, "aligned_allocator: the alignment must be a power of two");
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using is_always_equal = std::true_type;
+
+    template <typename U>
+    struct rebind {
+      using other = aligned_allocator<U, Align>;
+    };
+
+    static constexpr std::size_t alignment = Align > alignof(T) ? Align : alignof(T);
+
+    aligned_allocator() noexcept = default;
+
+    template <typename U>
+    aligned_allocator(const aligned_allocator<U, Align> &) noexcept {}
+
+    T *allocate(size_type n)
+    {
+      if (n > static_cast<size_type>(-1) / sizeof(T)) {
+        throw std::bad_array_new_length();
+      }
+      return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignment)));
+    }
+
+    void deallocate(T *ptr, size_type n) noexcept
+    {
+      ::operator delete(ptr, n * sizeof(T), std::align_val_t(alignment));
+    }
+
+    friend bool operator==(const aligned_allocator &, const aligned_allocator &) noexcept { return true; }
+    friend bool operator!=(const aligned_allocator &, const aligned_allocator &) noexcept { return false; }
+  };
+
+  // s21_vector whose data() is aligned to Align bytes
+  template <typename T, std::size_t Align = 64, typename GrowthPolicy = growth::doubling<>>
+  using aligned_vector = s21_vector<T, aligned_allocator<T, Align>, GrowthPolicy>;
+
+}
+
+#endif  // SRC_S21_ALIGNED_ALLOCATOR_H_
@@ -0,0 +1,629 @@
+#ifndef SRC_S21_COMPACT_VECTOR_H_
+#define SRC_S21_COMPACT_VECTOR_H_
+
+#include <limits>
+#include <new>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // Allocator adaptor that narrows size_type, which s21_vector uses for its size
+  // and capacity members: with uint32_t the vector header is a pointer and two
+  // 32-bit counts, 16 bytes instead of 24, and max_size() stops at 2^32 - 1
+  // elements. Allocation itself is left to Base.
+  template <typename T, typename SizeType = std::uint32_t, typename Base = std::allocator<T>>
+  class compact_allocator : public Base
+  {
+    using base_traits = std::allocator_traits<Base>;
+
+    static_assert(std::is_unsigned<SizeType>::value, "compact_allocator: size_type must be an unsigned integer");
+
+  public:
+    using value_type = T;
+    using size_type = SizeType;
+    using difference_type = typename base_traits::difference_type;
+    using propagate_on_container_copy_assignment = typename base_traits::propagate_on_container_copy_assignment;
+    using propagate_on_container_move_assignment = typename base_traits::propagate_on_container_move_assignment;
+    using propagate_on_container_swap = typename base_traits::propagate_on_container_swap;
+    using is_always_equal = typename base_traits::is_always_equal;
+
+    template <typename U>
+    struct rebind {
+      using other = compact_allocator<U, SizeType, typename base_traits::template rebind_alloc<U>>;
+    };
+
+    compact_allocator() = default;
+
+    explicit compact_allocator(const Base &base) : Base(base) {}
+
+    template <typename U, typename B>
+    compact_allocator(const compact_allocator<U, SizeType, B> &other) : Base(static_cast<const B&>(other)) {}
+
+    T *allocate(size_type n)
+    {
+      if (n > max_size()) {
+        throw std::bad_array_new_length();
+      }
+      return base_traits::allocate(*this, n);
+    }
+
+    void deallocate(T *ptr, size_type n) noexcept
+    {
+      base_traits::deallocate(*this, ptr, n);
+    }
+
+    size_type max_size() const noexcept
+    {
+      std::size_t by_base = base_traits::max_size(*this);
+      std::size_t by_size = std::numeric_limits<size_type>::max();
+      return static_cast<size_type>(by_base < by_size ? by_base : by_size);
+    }
+
+    template <typename U, typename B>
+    bool operator==(const compact_allocator<U, SizeType, B> &other) const noexcept
+    {
+      return static_cast<const Base&>(*this) == static_cast<const B&>(other);
+    }
+
+    template <typename U, typename B>
+    bool operator!=(const compact_allocator<U, SizeType, B> &other) const noexcept
+    {
+      return !(*this == other);
+    }
+  };
+
+  // s21_vector with 32-bit size and capacity: 16 bytes per vector
+  template <typename T, typename SizeType = std::uint32_t, typename GrowthPolicy = growth::doubling<>>
+  using compact_vector = s21_vector<T, compact_allocator<T, SizeType>, GrowthPolicy>;
+
+  // Vector that is a single pointer: size and capacity live in front of the
+  // elements in the heap block, so the object is 8 bytes (with a stateless
+  // allocator) and an empty vector allocates nothing at all. Reading the size
+  // costs one extra dereference, which is the trade for fitting many more small
+  // vectors, such as adjacency lists, in cache. Iterators are s21_vector's.
+  template <typename T, typename SizeType = std::uint32_t, typename Allocator = std::allocator<T>>
+  class thin_vector
+  {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_unsigned<SizeType>::value, "thin_vector: size_type must be an unsigned integer");
+    static_assert(!std::is_same<T, bool>::value, "thin_vector: no bit-packed variant, store char");
+
+    struct header {
+      SizeType size;
+      SizeType capacity;
+    };
+
+    // the block is allocated in units that are aligned for both the header and T
+    static constexpr std::size_t unit_align = alignof(T) > alignof(header) ? alignof(T) : alignof(header);
+    static constexpr std::size_t data_offset = (sizeof(header) + unit_align - 1) / unit_align * unit_align;
+
+    struct alignas(unit_align) unit {
+      unsigned char bytes[unit_align];
+    };
+
+    using unit_allocator = typename alloc_traits::template rebind_alloc<unit>;
+    using unit_traits = std::allocator_traits<unit_allocator>;
+
+  public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = SizeType;
+    using difference_type = std::ptrdiff_t;
+    using iterator = typename s21_vector<T>::iterator;
+    using const_iterator = typename s21_vector<T>::const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    thin_vector() noexcept(noexcept(Allocator())) : thin_vector(Allocator()) {} // default constructor, allocates nothing
+
+    explicit thin_vector(const Allocator &alloc) noexcept // creates empty vector which will allocate from alloc
+        : alloc_(alloc), block_(nullptr) {}
+
+    thin_vector(size_type n, const_reference value = T(), const Allocator &alloc = Allocator()) : thin_vector(alloc)  // creates n copies of value
+    {
+      resize(n, value);
+    }
+
+    thin_vector(std::initializer_list<value_type> const &items, const Allocator &alloc = Allocator()) // initializer list constructor
+        : thin_vector(alloc)
+    {
+      append_range(items.begin(), items.end());
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    thin_vector(InputIt first, InputIt last, const Allocator &alloc = Allocator()) : thin_vector(alloc) // range constructor, copies [first, last)
+    {
+      append_range(first, last);
+    }
+
+    thin_vector(const thin_vector &v) // copy constructor, allocates exactly v.size() elements
+        : thin_vector(alloc_traits::select_on_container_copy_construction(v.alloc_))
+    {
+      append_range(v.begin(), v.end());
+    }
+
+    thin_vector(thin_vector &&v) noexcept // move constructor, takes the block of v
+        : alloc_(v.alloc_), block_(v.block_)
+    {
+      v.block_ = nullptr;
+    }
+
+    thin_vector &operator=(const thin_vector &v) // copy assignment, propagates the allocator when its traits ask for it
+    {
+      if (this != &v) {
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          if (alloc_ != v.alloc_) {
+            release();  // the block belongs to the allocator being replaced
+          }
+          alloc_ = v.alloc_;
+        }
+        clear();
+        append_range(v.begin(), v.end());
+      }
+      return *this;
+    }
+
+    thin_vector &operator=(thin_vector &&v) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                     alloc_traits::is_always_equal::value) // assignment operator overload for moving object
+    {
+      if (this != &v) {
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          release();
+          alloc_ = std::move(v.alloc_);
+          block_ = v.block_;
+          v.block_ = nullptr;
+        } else {
+            if (alloc_traits::is_always_equal::value || alloc_ == v.alloc_) {
+              release();
+              block_ = v.block_;
+              v.block_ = nullptr;
+            } else {  // our allocator stays, so the elements have to move one by one
+                clear();
+                append_range(std::make_move_iterator(v.begin()), std::make_move_iterator(v.end()));
+                v.release();
+            }
+        }
+      }
+      return *this;
+    }
+
+    ~thin_vector() noexcept // destructor
+    {
+      release();
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+      return alloc_;
+    }
+
+// Capacity =====================================================================================
+    bool empty() const noexcept // checks whether the container is empty
+    {
+      return size() ? false : true;
+    }
+
+    size_type size() const noexcept  // returns the number of elements
+    {
+      return block_ ? block_->size : 0;
+    }
+
+    size_type max_size() const noexcept // returns the maximum possible number of elements
+    {
+      std::size_t by_size = std::numeric_limits<size_type>::max();
+      std::size_t by_block = (std::numeric_limits<std::size_t>::max() / 2 - data_offset) / sizeof(value_type);
+      return static_cast<size_type>(by_size < by_block ? by_size : by_block);
+    }
+
+    void reserve(size_type new_capacity)  // allocates a block for new_capacity elements and relocates the elements into it
+    {
+      if (new_capacity > capacity()) {
+        reallocate(new_capacity);
+      }
+    }
+
+    void resize(size_type new_size, const_reference value = T())
+    {
+      size_type old_size = size();
+      if (new_size > old_size) {
+        value_type tmp(value);  // value may live in the block reserve is about to move
+        reserve(new_size);
+        detail::uninitialized_fill_n(alloc_, data() + old_size, new_size - old_size, tmp);
+        block_->size = new_size;
+      } else if (new_size < old_size) {
+          detail::destroy(alloc_, data() + new_size, data() + old_size);
+          block_->size = new_size;
+      }
+    }
+
+    size_type capacity() const noexcept // returns the number of elements that fit in the current block
+    {
+      return block_ ? block_->capacity : 0;
+    }
+
+    void shrink_to_fit()  // reallocates to exactly size() elements, freeing the block of an empty vector
+    {
+      if (capacity() > size()) {
+        reallocate(size());
+      }
+    }
+
+    static constexpr std::size_t block_bytes(size_type capacity) noexcept  // heap bytes used for capacity elements
+    {
+      return capacity ? units(capacity) * sizeof(unit) : 0;
+    }
+
+// Modifiers ====================================================================================
+    void clear() noexcept  // clears the contents, keeps the block
+    {
+      if (block_) {
+        detail::destroy(alloc_, data(), data() + block_->size);
+        block_->size = 0;
+      }
+    }
+
+    iterator insert(const_iterator pos, const_reference value)  // inserts value before pos and returns the iterator that points to it
+    {
+      return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, value_type &&value)  // inserts value by moving it before pos
+    {
+      return emplace(pos, std::move(value));
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)  // constructs an element in place before pos and returns the iterator to it
+    {
+      size_type index = static_cast<size_type>(pos - cbegin());
+      if (index == size()) {
+        emplace_back(std::forward<Args>(args)...);
+        return iterator(data() + index);
+      }
+
+      value_type tmp(std::forward<Args>(args)...);  // args may refer to the tail we are about to shift
+      return insert_constructed(index, 1, [&](value_type *dest) {
+        alloc_traits::construct(alloc_, dest, std::move(tmp));
+      });
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)  // inserts [first, last) before pos with a single shift of the tail
+    {
+      size_type index = static_cast<size_type>(pos - cbegin());
+      if constexpr (detail::is_forward_iterator<InputIt>::value) {
+        std::size_t n = static_cast<std::size_t>(std::distance(first, last));  // not size_type: a narrow one would wrap
+        return insert_constructed(index, n, [&](value_type *dest) {
+          detail::uninitialized_copy(alloc_, first, last, dest);
+        });
+      } else {
+          thin_vector buffered(alloc_);  // single pass input: count it before touching our tail
+          buffered.append_range(first, last);
+          return insert(pos, std::make_move_iterator(buffered.begin()), std::make_move_iterator(buffered.end()));
+      }
+    }
+
+    template <typename InputIt>
+    void append_range(InputIt first, InputIt last)  // appends [first, last), growing the block at most once for forward ranges
+    {
+      if constexpr (detail::is_forward_iterator<InputIt>::value) {
+        insert(cend(), first, last);
+      } else {
+          for (; first != last; ++first) {
+            emplace_back(*first);
+          }
+      }
+    }
+
+    void erase(const_iterator pos)  // erases element at pos
+    {
+      size_type index = static_cast<size_type>(pos - cbegin());
+      if (index >= size()) {
+        throw std::out_of_range("Invalid pointer");
+      }
+
+      value_type *ptr = data() + index;
+      alloc_traits::destroy(alloc_, ptr);
+      try {
+        detail::relocate_left(alloc_, ptr + 1, data() + block_->size, 1);
+      } catch (...) {
+          block_->size = index;
+          throw;
+      }
+      --block_->size;
+    }
+
+    void push_back(const_reference value)
+    {
+      emplace_back(value);
+    }
+
+    void push_back(value_type &&value)  // appends value by moving it
+    {
+      emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)  // constructs an element in place at the end
+    {
+      size_type old_size = size();
+      if (capacity() == old_size) {
+        size_type new_capacity = recommend(old_size + 1);
+        header *new_block = allocate_block(new_capacity);
+        value_type *new_data = elements(new_block);
+        try {
+          alloc_traits::construct(alloc_, new_data + old_size, std::forward<Args>(args)...);  // before relocating: args may be ours
+        } catch (...) {
+            deallocate_block(new_block);
+            throw;
+        }
+        try {
+          detail::relocate(alloc_, data(), data() + old_size, new_data);
+        } catch (...) {
+            alloc_traits::destroy(alloc_, new_data + old_size);
+            deallocate_block(new_block);
+            throw;
+        }
+        replace_block(new_block);
+      } else {
+          alloc_traits::construct(alloc_, data() + old_size, std::forward<Args>(args)...);
+      }
+      block_->size = old_size + 1;
+      return back();
+    }
+
+    void pop_back() noexcept // removes the last element
+    {
+      --block_->size;
+      alloc_traits::destroy(alloc_, data() + block_->size);
+    }
+
+    void swap(thin_vector &other) noexcept(alloc_traits::propagate_on_container_swap::value ||
+                                           alloc_traits::is_always_equal::value) // swaps the blocks; with unequal allocators that don't propagate the elements are moved
+    {
+      if (alloc_traits::propagate_on_container_swap::value || alloc_traits::is_always_equal::value || alloc_ == other.alloc_) {
+        std::swap(block_, other.block_);
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+          std::swap(alloc_, other.alloc_);
+        }
+      } else {
+          thin_vector tmp(std::move(other));
+          other = std::move(*this);
+          *this = std::move(tmp);
+      }
+    }
+
+// Element access =============================================================================
+    reference at(size_type j) // access specified element with bounds checking
+    {
+      if (j >= size()) {
+        throw std::out_of_range("thin_vector::at: index out of range");
+      }
+      return data()[j];
+    }
+
+    const_reference at(size_type j) const
+    {
+      if (j >= size()) {
+        throw std::out_of_range("thin_vector::at: index out of range");
+      }
+      return data()[j];
+    }
+
+    reference operator[](size_type j) noexcept // access specified element
+    {
+      return data()[j];
+    }
+
+    const_reference operator[](size_type j) const noexcept // access specified element
+    {
+      return data()[j];
+    }
+
+    reference front() noexcept // access the first element
+    {
+      return data()[0];
+    }
+
+    const_reference front() const noexcept // access the first element
+    {
+      return data()[0];
+    }
+
+    reference back() noexcept // access the last element
+    {
+      return data()[block_->size - 1];
+    }
+
+    const_reference back() const noexcept // access the last element
+    {
+      return data()[block_->size - 1];
+    }
+
+    value_type *data() noexcept  // direct access to the elements, nullptr before the first allocation
+    {
+      return block_ ? elements(block_) : nullptr;
+    }
+
+    const value_type *data() const noexcept  // direct access to the elements, nullptr before the first allocation
+    {
+      return block_ ? elements(block_) : nullptr;
+    }
+
+// Iterators ====================================================================================
+    iterator begin() noexcept  // returns an iterator to the beginning
+    {
+      return iterator(data());
+    }
+
+    const_iterator begin() const noexcept
+    {
+      return const_iterator(data());
+    }
+
+    iterator end() noexcept  // returns an iterator to the end
+    {
+      return iterator(data() + size());
+    }
+
+    const_iterator end() const noexcept
+    {
+      return const_iterator(data() + size());
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+    reverse_iterator rbegin() noexcept  // returns a reverse iterator to the last element
+    {
+      return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+      return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept  // returns a reverse iterator past the first element
+    {
+      return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+      return const_reverse_iterator(begin());
+    }
+
+  private:
+    static constexpr std::size_t units(size_type capacity) noexcept  // units holding the header and capacity elements
+    {
+      return (data_offset + static_cast<std::size_t>(capacity) * sizeof(value_type) + sizeof(unit) - 1) / sizeof(unit);
+    }
+
+    static value_type *elements(header *block) noexcept
+    {
+      return reinterpret_cast<value_type*>(reinterpret_cast<unsigned char*>(block) + data_offset);
+    }
+
+    static const value_type *elements(const header *block) noexcept
+    {
+      return reinterpret_cast<const value_type*>(reinterpret_cast<const unsigned char*>(block) + data_offset);
+    }
+
+    // a block for capacity elements whose header says it holds none yet
+    header *allocate_block(size_type capacity)
+    {
+      unit_allocator units_alloc(alloc_);
+      unit *memory = unit_traits::allocate(units_alloc, units(capacity));
+      return ::new (static_cast<void*>(memory)) header{0, capacity};
+    }
+
+    void deallocate_block(header *block) noexcept // doesn't call the destructors!
+    {
+      unit_allocator units_alloc(alloc_);
+      unit_traits::deallocate(units_alloc, reinterpret_cast<unit*>(block), units(block->capacity));
+    }
+
+    // frees the current block, whose elements were relocated, and keeps new_block
+    void replace_block(header *new_block) noexcept
+    {
+      if (block_) {
+        new_block->size = block_->size;
+        deallocate_block(block_);
+      }
+      block_ = new_block;
+    }
+
+    // destroys the elements and frees the block, leaving *this empty
+    void release() noexcept
+    {
+      if (block_) {
+        clear();
+        deallocate_block(block_);
+        block_ = nullptr;
+      }
+    }
+
+    void reallocate(size_type new_capacity)
+    {
+      if (new_capacity == 0) {
+        release();
+        return;
+      }
+      header *new_block = allocate_block(new_capacity);
+      try {
+        detail::relocate(alloc_, data(), data() + size(), elements(new_block));
+      } catch (...) {
+          deallocate_block(new_block);
+          throw;
+      }
+      replace_block(new_block);
+    }
+
+    // capacity for required elements: at least double the current one, at most max_size()
+    size_type recommend(std::size_t required) const
+    {
+      std::size_t limit = max_size();
+      if (required > limit) {
+        throw std::length_error("thin_vector: size exceeds max_size()");
+      }
+      std::size_t doubled = 2 * static_cast<std::size_t>(capacity());
+      std::size_t grown = required > doubled ? required : doubled;
+      return static_cast<size_type>(grown < limit ? grown : limit);
+    }
+
+    // grows at most once, shifts the tail by k at most once and lets construct fill
+    // the k raw slots at index; construct must clean up after itself if it throws.
+    // k is checked against max_size() before it is narrowed to size_type
+    template <typename Construct>
+    iterator insert_constructed(size_type index, std::size_t count, Construct construct)
+    {
+      if (count) {
+        size_type old_size = size();
+        if (count > static_cast<std::size_t>(max_size() - old_size)) {
+          throw std::length_error("thin_vector: size exceeds max_size()");
+        }
+        size_type k = static_cast<size_type>(count);
+        if (static_cast<std::size_t>(old_size) + k > capacity()) {
+          reserve(recommend(static_cast<std::size_t>(old_size) + k));
+        }
+        value_type *array = data();
+        try {
+          detail::relocate_right(alloc_, array + index, array + old_size, k);
+        } catch (...) {
+            block_->size = index;
+            throw;
+        }
+        try {
+          construct(array + index);
+        } catch (...) {
+            try {
+              detail::relocate_left(alloc_, array + index + k, array + old_size + k, k);
+            } catch (...) {
+                block_->size = index;
+            }
+            throw;
+        }
+        block_->size = old_size + k;
+      }
+      return iterator(data() + index);
+    }
+
+    [[no_unique_address]] Allocator alloc_;
+    header *block_;  // size, capacity, then the elements; nullptr until something is stored
+  };
+
+}
+
+#endif  // SRC_S21_COMPACT_VECTOR_H_
@@ -0,0 +1,389 @@
+#ifndef SRC_S21_CONCURRENT_VECTOR_H_
+#define SRC_S21_CONCURRENT_VECTOR_H_
+
+#include <atomic>
+#include <new>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // Append-only vector for many writers and readers at once. Elements live in
+  // segments of 8, 16, 32, 64, ... slots that are allocated when first needed
+  // and never move, so a reference or index stays valid while others append.
+  //
+  // A writer claims its slots with one fetch_add, builds its elements there in
+  // parallel with everyone else and flags each slot ready. size() is the length
+  // of the prefix of ready slots, so readers may index anything below size()
+  // while writers are still appending. No writer waits for another: the one that
+  // completes the prefix moves size() past whatever later slots are ready.
+  //
+  // Elements are built (or copied) before any slot is claimed and then moved in,
+  // so only nothrow-movable types are accepted and a throwing constructor never
+  // leaves a slot unfilled. Failing to allocate a segment after slots have been claimed
+  // calls std::terminate. The allocator is shared by all writers. clear() and
+  // destruction must not race with anything.
+  template <typename T, typename Allocator = std::allocator<T>>
+  class concurrent_vector
+  {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_nothrow_move_constructible<T>::value,
+                  "concurrent_vector: elements are moved into claimed slots, which must not fail");
+
+    static constexpr std::size_t first_segment_log = 3;
+    static constexpr std::size_t first_segment = std::size_t(1) << first_segment_log;
+    static constexpr std::size_t max_segments = 64 - first_segment_log;
+
+    template <bool Const>
+    class segment_iterator;
+
+  public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = segment_iterator<false>;
+    using const_iterator = segment_iterator<true>;
+
+    concurrent_vector() noexcept(noexcept(Allocator())) : concurrent_vector(Allocator()) {} // default constructor, creates empty vector
+
+    explicit concurrent_vector(const Allocator &alloc) noexcept // creates empty vector which will allocate segments from alloc
+        : alloc_(alloc), claimed_(0), size_(0)
+    {
+      for (std::atomic<T*> &segment : segments_) {
+        segment.store(nullptr, std::memory_order_relaxed);
+      }
+    }
+
+    concurrent_vector(const concurrent_vector &) = delete;
+    concurrent_vector &operator=(const concurrent_vector &) = delete;
+
+    ~concurrent_vector() noexcept // destructor
+    {
+      clear();
+      for (size_type k = 0; k != max_segments; ++k) {
+        if (T *segment = segments_[k].load(std::memory_order_relaxed)) {
+          alloc_traits::deallocate(alloc_, segment, segment_size(k) + flag_slots(k));
+        }
+      }
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+      return alloc_;
+    }
+
+// Capacity =====================================================================================
+    bool empty() const noexcept // checks whether no element has been published yet
+    {
+      return size() == 0;
+    }
+
+    size_type size() const noexcept  // returns the number of fully constructed elements
+    {
+      return size_.load(std::memory_order_acquire);
+    }
+
+    size_type capacity() const noexcept // returns the number of slots in the segments allocated so far
+    {
+      size_type total = 0;
+      for (size_type k = 0; k != max_segments; ++k) {
+        total += segments_[k].load(std::memory_order_acquire) ? segment_size(k) : 0;
+      }
+      return total;
+    }
+
+    void reserve(size_type n)  // allocates every segment the first n slots live in
+    {
+      if (n) {
+        for (size_type k = 0, last = segment_of(n - 1); k <= last; ++k) {
+          segment(k);
+        }
+      }
+    }
+
+// Modifiers ====================================================================================
+    void clear() noexcept  // destroys the elements, keeps the segments; must not race with anything
+    {
+      size_type n = size_.load(std::memory_order_relaxed);
+      for (size_type j = 0; j != n; ++j) {
+        alloc_traits::destroy(alloc_, &slot(j));
+        ready(j).store(0, std::memory_order_relaxed);
+      }
+      claimed_.store(0, std::memory_order_relaxed);
+      size_.store(0, std::memory_order_release);
+    }
+
+    iterator push_back(const_reference value)  // appends a copy of value, returns an iterator to it
+    {
+      return emplace_back(value);
+    }
+
+    iterator push_back(value_type &&value)
+    {
+      return emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    iterator emplace_back(Args&&... args)  // constructs the element first, then claims a slot and moves it in
+    {
+      value_type tmp(std::forward<Args>(args)...);
+      size_type index = claimed_.fetch_add(1, std::memory_order_relaxed);
+      fill(index, 1, [&tmp](size_type) { return T(std::move(tmp)); });
+      return iterator(this, index);
+    }
+
+    iterator grow_by(size_type n)  // appends n value-initialized elements in one claim, returns an iterator to the first
+    {
+      if constexpr (std::is_nothrow_default_constructible<T>::value) {
+        size_type index = claimed_.fetch_add(n, std::memory_order_relaxed);
+        fill(index, n, [](size_type) { return T(); });
+        return iterator(this, index);
+      } else {
+          return append_moved(s21_vector<T, Allocator>(n, alloc_));
+      }
+    }
+
+    iterator grow_by(size_type n, const_reference value)  // appends n copies of value in one claim
+    {
+      if constexpr (std::is_nothrow_copy_constructible<T>::value) {
+        size_type index = claimed_.fetch_add(n, std::memory_order_relaxed);
+        fill(index, n, [&value](size_type) { return T(value); });
+        return iterator(this, index);
+      } else {
+          return append_moved(s21_vector<T, Allocator>(n, value, alloc_));
+      }
+    }
+
+// Element access =============================================================================
+
+    reference at(size_type j) // access a published element with bounds checking
+    {
+      if (j >= size()) {
+        throw std::out_of_range("concurrent_vector::at: index out of range");
+      }
+      return slot(j);
+    }
+
+    const_reference at(size_type j) const
+    {
+      if (j >= size()) {
+        throw std::out_of_range("concurrent_vector::at: index out of range");
+      }
+      return slot(j);
+    }
+
+    reference operator[](size_type j) noexcept // access specified element, j must be below a size() the caller has seen
+    {
+      return slot(j);
+    }
+
+    const_reference operator[](size_type j) const noexcept // access specified element
+    {
+      return slot(j);
+    }
+
+    reference front() noexcept // access the first element
+    {
+      return slot(0);
+    }
+
+    const_reference front() const noexcept // access the first element
+    {
+      return slot(0);
+    }
+
+// Iterators ====================================================================================
+    // end() is taken from size() when it is called: an iteration sees the
+    // elements published by then, however many are appended while it runs.
+
+    iterator begin() noexcept  // returns an iterator to the beginning
+    {
+      return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept
+    {
+      return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept  // returns an iterator past the elements published so far
+    {
+      return iterator(this, size());
+    }
+
+    const_iterator end() const noexcept
+    {
+      return const_iterator(this, size());
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+  private:
+    template <bool Const>
+    class segment_iterator {  // random access by index; each dereference looks the segment up
+      friend class concurrent_vector;
+      friend class segment_iterator<!Const>;
+
+      using owner = std::conditional_t<Const, const concurrent_vector, concurrent_vector>;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        segment_iterator() : owner_(nullptr), index_(0) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        segment_iterator(const segment_iterator<false> &other) : owner_(other.owner_), index_(other.index_) {}
+
+        reference operator*() const { return owner_->slot(index_); }
+        pointer operator->() const { return &owner_->slot(index_); }
+        reference operator[](difference_type n) const { return owner_->slot(index_ + n); }
+
+        segment_iterator &operator++() { ++index_; return *this; }
+        segment_iterator operator++(int) { segment_iterator tmp(*this); ++index_; return tmp; }
+        segment_iterator &operator--() { --index_; return *this; }
+        segment_iterator operator--(int) { segment_iterator tmp(*this); --index_; return tmp; }
+        segment_iterator &operator+=(difference_type n) { index_ += n; return *this; }
+        segment_iterator &operator-=(difference_type n) { index_ -= n; return *this; }
+
+        friend segment_iterator operator+(segment_iterator it, difference_type n) { return it += n; }
+        friend segment_iterator operator+(difference_type n, segment_iterator it) { return it += n; }
+        friend segment_iterator operator-(segment_iterator it, difference_type n) { return it -= n; }
+
+        template <bool C>
+        difference_type operator-(const segment_iterator<C> &other) const { return difference_type(index_) - difference_type(other.index_); }
+        template <bool C>
+        bool operator==(const segment_iterator<C> &other) const { return index_ == other.index_; }
+        template <bool C>
+        bool operator!=(const segment_iterator<C> &other) const { return index_ != other.index_; }
+        template <bool C>
+        bool operator<(const segment_iterator<C> &other) const { return index_ < other.index_; }
+        template <bool C>
+        bool operator>(const segment_iterator<C> &other) const { return index_ > other.index_; }
+        template <bool C>
+        bool operator<=(const segment_iterator<C> &other) const { return index_ <= other.index_; }
+        template <bool C>
+        bool operator>=(const segment_iterator<C> &other) const { return index_ >= other.index_; }
+
+      private:
+        segment_iterator(owner *vector, size_type index) : owner_(vector), index_(index) {}
+
+        owner *owner_;
+        size_type index_;
+    };
+
+    static size_type segment_size(size_type k) noexcept
+    {
+      return first_segment << k;
+    }
+
+    static size_type segment_of(size_type j) noexcept  // slot j is in segment floor(log2(j + 8)) - 3
+    {
+      return static_cast<size_type>(63 - __builtin_clzll(j + first_segment)) - first_segment_log;
+    }
+
+    static size_type flag_slots(size_type k) noexcept  // extra T slots at the end of segment k that hold its ready flags
+    {
+      return (segment_size(k) + sizeof(T) - 1) / sizeof(T);
+    }
+
+    T &slot(size_type j) const noexcept
+    {
+      size_type k = segment_of(j);
+      return segments_[k].load(std::memory_order_acquire)[j + first_segment - segment_size(k)];
+    }
+
+    std::atomic<unsigned char> &ready(size_type j) noexcept  // set once slot j holds its element; segment_of(j) must exist
+    {
+      size_type k = segment_of(j);
+      T *base = segments_[k].load(std::memory_order_acquire);
+      return reinterpret_cast<std::atomic<unsigned char>*>(base + segment_size(k))[j + first_segment - segment_size(k)];
+    }
+
+    bool is_ready(size_type j) noexcept  // a slot whose segment does not exist yet cannot be ready
+    {
+      size_type k = segment_of(j);
+      return segments_[k].load(std::memory_order_seq_cst) && ready(j).load(std::memory_order_seq_cst);
+    }
+
+    T *segment(size_type k)  // segment k, allocated by whichever thread needs it first
+    {
+      T *current = segments_[k].load(std::memory_order_acquire);
+      if (current) {
+        return current;
+      }
+      T *fresh = alloc_traits::allocate(alloc_, segment_size(k) + flag_slots(k));
+      auto *flags = reinterpret_cast<unsigned char*>(fresh + segment_size(k));
+      for (size_type j = 0; j != segment_size(k); ++j) {
+        new (flags + j) std::atomic<unsigned char>(0);
+      }
+      if (segments_[k].compare_exchange_strong(current, fresh, std::memory_order_seq_cst)) {
+        return fresh;
+      }
+      alloc_traits::deallocate(alloc_, fresh, segment_size(k) + flag_slots(k));  // another thread won, current is its segment
+      return current;
+    }
+
+    iterator append_moved(s21_vector<T, Allocator> &&items)  // the copies that could throw are already made
+    {
+      size_type index = claimed_.fetch_add(items.size(), std::memory_order_relaxed);
+      fill(index, items.size(), [&items](size_type j) { return T(std::move(items[j])); });
+      return iterator(this, index);
+    }
+
+    // fills the claimed slots [index, index + n) with make(0), ..., make(n - 1) and flags them ready
+    template <typename Make>
+    void fill(size_type index, size_type n, Make make) noexcept
+    {
+      for (size_type j = index, last = index + n; j != last;) {
+        size_type k = segment_of(j);
+        size_type offset = j + first_segment - segment_size(k);
+        size_type chunk = segment_size(k) - offset < last - j ? segment_size(k) - offset : last - j;
+        T *base = segment(k);
+        auto *flags = reinterpret_cast<std::atomic<unsigned char>*>(base + segment_size(k));
+        for (size_type i = offset; i != offset + chunk; ++i, ++j) {
+          alloc_traits::construct(alloc_, base + i, make(j - index));
+          flags[i].store(1, std::memory_order_seq_cst);
+        }
+      }
+      publish();
+    }
+
+    // moves size() over every ready slot that directly follows it. Whoever fills the
+    // slot size() is stuck at carries it on, past slots other writers finished
+    // earlier. Segment creation, flag stores and every access here are seq_cst so
+    // that, of a writer flagging slot j and one moving size_ up to j, at least one
+    // sees the other.
+    void publish() noexcept
+    {
+      size_type published = size_.load(std::memory_order_seq_cst);
+      while (is_ready(published)) {
+        size_.compare_exchange_weak(published, published + 1, std::memory_order_seq_cst);
+        published = size_.load(std::memory_order_seq_cst);
+      }
+    }
+
+    [[no_unique_address]] Allocator alloc_;
+    std::atomic<T*> segments_[max_segments];
+    std::atomic<size_type> claimed_;
+    std::atomic<size_type> size_;
+  };
+
+}
+
+#endif  // SRC_S21_CONCURRENT_VECTOR_H_
@@ -3,8 +3,34 @@
 #include "s21_list.h"
 #include "s21_stack.h"
 #include "s21_vector.h"
+#include "s21_vector_stats.h"
+#include "s21_small_vector.h"
+#include "s21_compact_vector.h"
+#include "s21_gap_vector.h"
+#include "s21_incremental_vector.h"
+#include "s21_mmap_allocator.h"
+#include "s21_aligned_allocator.h"
+#include "s21_simd.h"
+#include "s21_mapped_vector.h"
+#include "s21_soa_vector.h"
+#include "s21_concurrent_vector.h"
+#include "s21_serialize.h"
+#include "s21_flat_set.h"
+#include "s21_flat_map.h"
+#include "s21_packed_int_vector.h"
+#include "s21_span.h"
 #include "s21_queue.h"
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
 #include <stack>
+#include <string>
+#include <thread>
 #include <queue>
 #include <vector>
 #include <gtest/gtest.h>
@@ -64,7 +90,8 @@ TEST(VectorTest, MoveConstructor)
   EXPECT_EQ(v2[0], 1);
   EXPECT_EQ(v2[1], 2);
   EXPECT_EQ(v2[2], 3);
-  EXPECT_EQ(v1.size(), 3);
+  EXPECT_EQ(v1.size(), 0);
+  EXPECT_EQ(v1.capacity(), 0);
 }
 
 TEST(VectorTest, MoveAssignment)
@@ -77,7 +104,26 @@ TEST(VectorTest, MoveAssignment)
   EXPECT_EQ(v2[0], 1);
   EXPECT_EQ(v2[1], 2);
   EXPECT_EQ(v2[2], 3);
-  EXPECT_EQ(v1.size(), 3);
+  EXPECT_EQ(v1.size(), 0);
+  EXPECT_EQ(v1.capacity(), 0);
+}
+
+TEST(VectorTest, ReuseAfterMove)
+{
+  s21::s21_vector<std::string> v1 = {"a", "b", "c"};
+  s21::s21_vector<std::string> v2(std::move(v1));
+  s21::s21_vector<std::string> v3;
+  v3 = std::move(v2);
+
+  v1.push_back("d");
+  v2.emplace_back("e");
+  v2.push_back("f");
+
+  EXPECT_EQ(v1.size(), 1);
+  EXPECT_EQ(v1[0], "d");
+  EXPECT_EQ(v2.size(), 2);
+  EXPECT_EQ(v2[1], "f");
+  EXPECT_EQ(v3.size(), 3);
 }
 
 TEST(VectorTest, Destructor)
@@ -279,7 +325,2071 @@ TEST(VectorTest, Swap)
   EXPECT_EQ(v2[2], 3);
 }
 
-//__________________<<VECTOR<<____________________
+namespace {
+struct CopyCounter
+{
+  static int copies;
+  int value;
+
+  CopyCounter(int v = 0) : value(v) {}
+  CopyCounter(const CopyCounter &other) : value(other.value) { ++copies; }
+  CopyCounter(CopyCounter &&other) noexcept : value(other.value) {}
+  CopyCounter &operator=(const CopyCounter &other) { value = other.value; ++copies; return *this; }
+  CopyCounter &operator=(CopyCounter &&other) noexcept { value = other.value; return *this; }
+};
+int CopyCounter::copies = 0;
+}
+
+TEST(VectorTest, RelocationMovesElements)
+{
+  s21::s21_vector<CopyCounter> v = {1, 2, 3};
+  CopyCounter::copies = 0;
+
+  v.reserve(100);
+  v.shrink_to_fit();
+  v.erase(v.begin());
+
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[0].value, 2);
+  EXPECT_EQ(v[1].value, 3);
+}
+
+TEST(VectorTest, InsertEraseStrings)
+{
+  s21::s21_vector<std::string> v = {"alpha", "beta", "gamma"};
+
+  v.insert(v.begin(), "zero");
+  v.insert(++v.begin(), v[3]);
+  v.erase(++(++v.begin()));
+
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[0], "zero");
+  EXPECT_EQ(v[1], "gamma");
+  EXPECT_EQ(v[2], "beta");
+  EXPECT_EQ(v[3], "gamma");
+}
+
+TEST(VectorTest, PushBackOwnElement)
+{
+  s21::s21_vector<std::string> v = {"a long enough string to live on the heap"};
+
+  for (int i = 0; i < 5; ++i) {
+    v.push_back(v[0]);
+  }
+
+  EXPECT_EQ(v.size(), 6);
+  EXPECT_EQ(v[5], v[0]);
+}
+
+TEST(VectorTest, PushBackRvalue)
+{
+  s21::s21_vector<CopyCounter> v;
+  CopyCounter::copies = 0;
+
+  for (int i = 0; i < 10; ++i) {
+    v.push_back(CopyCounter(i));
+  }
+
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(v.size(), 10);
+  EXPECT_EQ(v[9].value, 9);
+}
+
+TEST(VectorTest, EmplaceBack)
+{
+  s21::s21_vector<std::pair<int, std::string>> v;
+
+  auto &ref = v.emplace_back(1, "one");
+  EXPECT_EQ(ref.second, "one");
+
+  v.emplace_back(2, "two");
+
+  EXPECT_EQ(v.size(), 2);
+  EXPECT_EQ(v[1].first, 2);
+  EXPECT_EQ(v[1].second, "two");
+}
+
+TEST(VectorTest, Emplace)
+{
+  s21::s21_vector<std::string> v = {"a", "d"};
+
+  auto it = v.emplace(++v.begin(), 2, 'b');
+  v.emplace(v.end(), "e");
+
+  EXPECT_EQ(*it, "bb");
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[1], "bb");
+  EXPECT_EQ(v[2], "d");
+  EXPECT_EQ(v[3], "e");
+}
+
+TEST(VectorTest, InsertManyBack)
+{
+  s21::s21_vector<std::string> v = {"a"};
+
+  v.insert_many_back(v[0], "b", std::string("c"));
+
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v.capacity(), 4);
+  EXPECT_EQ(v[1], "a");
+  EXPECT_EQ(v[2], "b");
+  EXPECT_EQ(v[3], "c");
+}
+
+TEST(VectorTest, InsertRange)
+{
+  s21::s21_vector<int> v = {1, 5};
+  std::vector<int> items = {2, 3, 4};
+
+  auto it = v.insert(++v.begin(), items.begin(), items.end());
+
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(v.size(), 5);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(v[i], i + 1);
+  }
+}
+
+TEST(VectorTest, InsertRangeGrowsOnce)
+{
+  s21::s21_vector<std::string> v = {"a", "e"};
+  std::vector<std::string> items = {"b", "c", "d"};
+
+  v.insert(++v.begin(), items.begin(), items.end());
+
+  EXPECT_EQ(v.capacity(), 5);
+  EXPECT_EQ(v[1], "b");
+  EXPECT_EQ(v[3], "d");
+  EXPECT_EQ(v[4], "e");
+}
+
+TEST(VectorTest, InsertRangeInputIterator)
+{
+  s21::s21_vector<int> v = {1, 4};
+  std::istringstream input("2 3");
+
+  v.insert(++v.begin(), std::istream_iterator<int>(input), std::istream_iterator<int>());
+
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[1], 2);
+  EXPECT_EQ(v[2], 3);
+  EXPECT_EQ(v[3], 4);
+}
+
+TEST(VectorTest, InsertCount)
+{
+  s21::s21_vector<std::string> v = {"a", "b"};
+
+  v.insert(++v.begin(), 3, v[0]);
+
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v[1], "a");
+  EXPECT_EQ(v[3], "a");
+  EXPECT_EQ(v[4], "b");
+}
+
+TEST(VectorTest, AppendRange)
+{
+  s21::s21_vector<int> v = {1};
+  int items[] = {2, 3, 4};
+
+  v.append_range(items, items + 3);
+
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v.capacity(), 4);
+  EXPECT_EQ(v[3], 4);
+}
+
+namespace {
+template <typename T>
+struct CountingAllocator
+{
+  using value_type = T;
+
+  int *allocations;
+
+  explicit CountingAllocator(int *counter) : allocations(counter) {}
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &other) : allocations(other.allocations) {}
+
+  T *allocate(std::size_t n)
+  {
+    ++*allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *ptr, std::size_t n) { std::allocator<T>().deallocate(ptr, n); }
+
+  bool operator==(const CountingAllocator &other) const { return allocations == other.allocations; }
+  bool operator!=(const CountingAllocator &other) const { return allocations != other.allocations; }
+};
+
+// CountingAllocator that follows the contents on copy assignment, move assignment and swap
+template <typename T>
+struct PropagatingAllocator : CountingAllocator<T>
+{
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  explicit PropagatingAllocator(int *counter) : CountingAllocator<T>(counter) {}
+  template <typename U>
+  PropagatingAllocator(const PropagatingAllocator<U> &other) : CountingAllocator<T>(other.allocations) {}
+};
+
+// a heap-backed resource that fails the test when asked to free a block it did not hand out
+class TrackingResource : public std::pmr::memory_resource
+{
+ public:
+  ~TrackingResource() override { EXPECT_TRUE(blocks_.empty()); }
+
+ private:
+  void *do_allocate(std::size_t bytes, std::size_t align) override
+  {
+    void *ptr = std::pmr::new_delete_resource()->allocate(bytes, align);
+    blocks_.insert(ptr);
+    return ptr;
+  }
+  void do_deallocate(void *ptr, std::size_t bytes, std::size_t align) override
+  {
+    if (blocks_.erase(ptr) == 0) {
+      ADD_FAILURE() << "freed a block of another resource";
+      return;
+    }
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, align);
+  }
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+
+  std::set<void*> blocks_;
+};
+}
+
+TEST(VectorTest, CustomAllocator)
+{
+  int allocations = 0;
+  CountingAllocator<int> alloc(&allocations);
+  s21::s21_vector<int, CountingAllocator<int>> v(alloc);
+
+  for (int i = 0; i < 8; ++i) {
+    v.push_back(i);
+  }
+
+  EXPECT_EQ(allocations, 4);
+  EXPECT_EQ(v.get_allocator(), alloc);
+  EXPECT_EQ(v[7], 7);
+}
+
+TEST(VectorTest, MoveAssignmentUnequalAllocators)
+{
+  int first = 0;
+  int second = 0;
+  CountingAllocator<std::string> first_alloc(&first);
+  CountingAllocator<std::string> second_alloc(&second);
+  s21::s21_vector<std::string, CountingAllocator<std::string>> v1({"a", "b"}, first_alloc);
+  s21::s21_vector<std::string, CountingAllocator<std::string>> v2(second_alloc);
+
+  v2 = std::move(v1);
+
+  EXPECT_EQ(second, 1);
+  EXPECT_EQ(v2.size(), 2);
+  EXPECT_EQ(v2[1], "b");
+  EXPECT_EQ(v2.get_allocator(), second_alloc);
+}
+
+TEST(VectorTest, CopyAssignment)
+{
+  s21::s21_vector<std::string> v1 = {"a", "b", "c"};
+  s21::s21_vector<std::string> v2 = {"d"};
+
+  v2 = v1;
+
+  EXPECT_EQ(v2.size(), 3);
+  EXPECT_EQ(v2[0], "a");
+  EXPECT_EQ(v2[2], "c");
+  EXPECT_EQ(v1.size(), 3);
+}
+
+TEST(VectorTest, PmrVector)
+{
+  char arena[1024];
+  std::pmr::monotonic_buffer_resource resource(arena, sizeof(arena), std::pmr::null_memory_resource());
+  s21::pmr::vector<int> v(&resource);
+
+  for (int i = 0; i < 16; ++i) {
+    v.push_back(i);
+  }
+
+  EXPECT_EQ(v.size(), 16);
+  EXPECT_EQ(v.get_allocator().resource(), &resource);
+  EXPECT_GE(static_cast<void*>(v.data()), static_cast<void*>(arena));
+  EXPECT_LT(static_cast<void*>(v.data()), static_cast<void*>(arena + sizeof(arena)));
+  EXPECT_EQ(v[15], 15);
+}
+
+TEST(VectorTest, RandomAccessIterator)
+{
+  s21::s21_vector<int> v = {5, 3, 9, 1, 7};
+  using traits = std::iterator_traits<s21::s21_vector<int>::iterator>;
+
+  std::sort(v.begin(), v.end());
+
+  EXPECT_TRUE((std::is_same<traits::iterator_category, std::random_access_iterator_tag>::value));
+  EXPECT_EQ(v.end() - v.begin(), 5);
+  EXPECT_EQ(v.begin()[2], 5);
+  EXPECT_EQ(*(v.begin() + 4), 9);
+  EXPECT_EQ(*(v.end() - 5), 1);
+  EXPECT_TRUE(v.begin() < v.end());
+  EXPECT_EQ(*std::lower_bound(v.begin(), v.end(), 6), 7);
+}
+
+TEST(VectorTest, ConstIterator)
+{
+  const s21::s21_vector<std::string> v = {"a", "bb", "ccc"};
+  size_t total = 0;
+
+  for (const auto &item : v) {
+    total += item.size();
+  }
+  s21::s21_vector<std::string>::const_iterator it = v.cbegin();
+
+  EXPECT_EQ(total, 6);
+  EXPECT_EQ(it->size(), 1);
+  EXPECT_EQ(v.cend() - it, 3);
+}
+
+TEST(VectorTest, ReverseIterator)
+{
+  s21::s21_vector<int> v = {1, 2, 3};
+  s21::s21_vector<int> reversed(v.rbegin(), v.rend());
+
+  EXPECT_EQ(reversed[0], 3);
+  EXPECT_EQ(reversed[2], 1);
+  EXPECT_EQ(*v.crbegin(), 3);
+  EXPECT_EQ(v.rend() - v.rbegin(), 3);
+}
+
+TEST(VectorTest, MixedIteratorComparison)
+{
+  s21::s21_vector<int> v = {1, 2, 3};
+  s21::s21_vector<int>::const_iterator cit = v.begin();
+
+  EXPECT_TRUE(cit == v.cbegin());
+  EXPECT_TRUE(v.cend() != cit);
+  v.insert(v.cbegin() + 1, 7);
+  EXPECT_EQ(v[1], 7);
+}
+
+TEST(VectorTest, EmplaceKeepsCapacity)
+{
+  s21::s21_vector<int> v = {1, 2};
+
+  v.reserve(8);
+  int *data = v.data();
+  v.emplace(v.begin(), 0);
+
+  EXPECT_EQ(v.capacity(), 8);
+  EXPECT_EQ(v.data(), data);
+}
+
+TEST(VectorTest, GrowthPolicyOneAndHalf)
+{
+  s21::s21_vector<int, std::allocator<int>, s21::growth::one_and_half<4>> v;
+  s21::s21_vector<size_t> capacities;
+
+  for (int i = 0; i < 20; ++i) {
+    v.push_back(i);
+    if (capacities.empty() || capacities.back() != v.capacity()) {
+      capacities.push_back(v.capacity());
+    }
+  }
+
+  EXPECT_EQ(capacities.size(), 5);
+  EXPECT_EQ(capacities[0], 4);
+  EXPECT_EQ(capacities[1], 6);
+  EXPECT_EQ(capacities[2], 9);
+  EXPECT_EQ(capacities[3], 14);
+  EXPECT_EQ(capacities[4], 21);
+}
+
+TEST(VectorTest, GrowthPolicyMinimumCapacity)
+{
+  s21::s21_vector<int, std::allocator<int>, s21::growth::doubling<16>> v;
+
+  v.push_back(1);
+
+  EXPECT_EQ(v.capacity(), 16);
+}
+
+TEST(VectorTest, GrowthPolicySizeClass)
+{
+  struct Twelve { char bytes[12]; };
+  using policy = s21::growth::size_class<>;
+  s21::s21_vector<Twelve, std::allocator<Twelve>, policy> v;
+
+  v.reserve(7);
+  for (int i = 0; i < 8; ++i) {
+    v.emplace_back();
+  }
+
+  EXPECT_EQ(policy::round_up(1), 16);
+  EXPECT_EQ(policy::round_up(129), 160);
+  EXPECT_EQ(policy::round_up(513), 640);
+  EXPECT_EQ(policy::round_up(4096), 4096);
+  EXPECT_EQ(v.capacity(), 16);
+}
+
+TEST(VectorTest, MmapVectorGrowsInPlace)
+{
+  s21::mmap_vector<uint64_t> v;
+
+  for (uint64_t i = 0; i < 1000000; ++i) {
+    v.push_back(i);
+  }
+  v.push_back(v[0]);
+
+  EXPECT_EQ(v.size(), 1000001);
+  EXPECT_EQ(v[999999], 999999);
+  EXPECT_EQ(v.back(), 0);
+
+  v.resize(10);
+  v.shrink_to_fit();
+
+  EXPECT_EQ(v.capacity(), 10);
+  EXPECT_EQ(v[9], 9);
+}
+
+TEST(VectorTest, MmapVectorNonTrivial)
+{
+  s21::mmap_vector<std::string> v = {"a", "b"};
+
+  v.insert(v.begin(), "z");
+  v.reserve(4096);
+
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], "z");
+  EXPECT_EQ(v[2], "b");
+}
+
+TEST(VectorTest, StatsPerInstance)
+{
+  s21::instrumented_vector<std::string> grown;
+  for (int i = 0; i < 100; ++i) {
+    grown.push_back("element");
+  }
+  s21::vector_stats g = s21::stats(grown);
+
+  EXPECT_EQ(g.allocations, 8);  // doubling from 1 to 128
+  EXPECT_EQ(g.reallocations, 7);
+  EXPECT_EQ(g.deallocations, 7);
+  EXPECT_EQ(g.relocated_bytes, (1 + 2 + 4 + 8 + 16 + 32 + 64) * sizeof(std::string));
+  EXPECT_EQ(g.constructions, 100 + 127);
+  EXPECT_EQ(g.peak_capacity_bytes, 128 * sizeof(std::string));
+  EXPECT_EQ(g.unused_bytes, 28 * sizeof(std::string));
+
+  s21::instrumented_vector<std::string> reserved;
+  reserved.reserve(100);
+  for (int i = 0; i < 100; ++i) {
+    reserved.push_back("element");
+  }
+  s21::vector_stats r = s21::stats(reserved);
+
+  EXPECT_EQ(r.allocations, 1);
+  EXPECT_EQ(r.reallocations, 0);
+  EXPECT_EQ(r.relocated_bytes, 0);
+  EXPECT_EQ(r.unused_bytes, 0);
+
+  s21::instrumented_vector<std::string> copy(grown);
+  EXPECT_EQ(s21::stats(copy).allocations, 1);
+  EXPECT_EQ(s21::stats(copy).constructions, 100);
+
+  s21::instrumented_vector<std::string> moved(std::move(grown));
+  EXPECT_EQ(s21::stats(moved).allocations, 8);
+
+  moved.erase(moved.cbegin(), moved.cbegin() + 10);
+  EXPECT_EQ(s21::stats(moved).relocated_bytes, g.relocated_bytes + 90 * sizeof(std::string));
+  EXPECT_EQ(s21::stats(moved).destructions - g.destructions, 10 + 90);
+}
+
+TEST(VectorTest, StatsPerType)
+{
+  using allocator = s21::stats_allocator<int>;
+  allocator::reset_totals();
+  {
+    s21::instrumented_vector<int> a;
+    a.reserve(10);
+    a.push_back(1);
+    a.push_back(2);
+    s21::instrumented_vector<int> b = {1, 2, 3};
+    b.push_back(4);
+  }
+  s21::vector_stats total = allocator::totals();
+
+  EXPECT_EQ(total.allocations, 3);
+  EXPECT_EQ(total.deallocations, 3);
+  EXPECT_EQ(total.reallocations, 1);
+  EXPECT_EQ(total.relocated_bytes, 3 * sizeof(int));
+  EXPECT_EQ(total.destructions, 0);
+  EXPECT_EQ(total.peak_capacity_bytes, 10 * sizeof(int));
+  EXPECT_EQ(total.wasted_bytes, (8 + 0 + 2) * sizeof(int));  // a kept 8 slots unused, b's first buffer was full
+
+  s21::s21_vector<int, s21::stats_allocator<int, s21::mmap_allocator<int>>> mapped;
+  for (int i = 0; i < 100000; ++i) {
+    mapped.push_back(i);
+  }
+  EXPECT_EQ(s21::stats(mapped).allocations, 1);
+  EXPECT_GT(s21::stats(mapped).reallocations, 0);
+  EXPECT_EQ(s21::stats(mapped).relocated_bytes, 0);
+  EXPECT_EQ(sizeof(s21::s21_vector<int>), 3 * sizeof(void*));
+}
+
+TEST(VectorTest, OverAlignedElements)
+{
+  struct alignas(64) Counter {
+    long value;
+  };
+  auto aligned = [](const void *ptr, std::size_t alignment) {
+    return reinterpret_cast<std::uintptr_t>(ptr) % alignment == 0;
+  };
+
+  s21::s21_vector<Counter> counters;
+  s21::s21_stack<Counter> stack;
+  s21::s21_queue<Counter> queue;
+  for (long i = 0; i < 100; ++i) {
+    counters.push_back(Counter{i});
+    EXPECT_TRUE(aligned(counters.data(), 64));
+    stack.push(Counter{i});
+    EXPECT_TRUE(aligned(&stack.top(), 64));
+    queue.push(Counter{i});
+    EXPECT_TRUE(aligned(&queue.back(), 64));
+  }
+  counters.insert(counters.cbegin() + 1, Counter{-1});
+  counters.shrink_to_fit();
+  EXPECT_TRUE(aligned(counters.data(), 64));
+  EXPECT_EQ(counters[1].value, -1);
+  EXPECT_EQ(counters[100].value, 99);
+
+  s21::aligned_vector<float> floats;
+  s21::aligned_vector<double, 256> wide(3, 1.5);
+  for (int i = 0; i < 1000; ++i) {
+    floats.push_back(static_cast<float>(i));
+    EXPECT_TRUE(aligned(floats.data(), 64));
+  }
+  floats.resize(17);
+  floats.shrink_to_fit();
+  EXPECT_TRUE(aligned(floats.data(), 64));
+  EXPECT_EQ(floats[16], 16.0f);
+  EXPECT_TRUE(aligned(wide.data(), 256));
+  EXPECT_EQ(s21::simd::sum(floats), 136.0f);
+
+  s21::s21_vector<bool, s21::aligned_allocator<bool>> bits(200, true);
+  EXPECT_EQ(bits.count(), 200);
+  EXPECT_EQ((s21::aligned_allocator<Counter, 16>::alignment), 64);
+}
+
+TEST(VectorTest, ResizeValueInitializes)
+{
+  s21::s21_vector<int> v = {1, 2};
+
+  v.resize(1);
+  v.resize(4);
+
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[0], 1);
+  EXPECT_EQ(v[1], 0);
+  EXPECT_EQ(v[3], 0);
+}
+
+TEST(VectorTest, ResizeDefaultInit)
+{
+  s21::s21_vector<uint8_t> v(16, s21::default_init);
+  s21::s21_vector<std::string> strings(2, s21::default_init);
+
+  std::memset(v.data(), 7, v.size());
+  v.resize_default_init(8);
+  strings.resize_default_init(3);
+
+  EXPECT_EQ(v.size(), 8);
+  EXPECT_EQ(v[7], 7);
+  EXPECT_EQ(strings.size(), 3);
+  EXPECT_TRUE(strings[2].empty());
+}
+
+TEST(VectorTest, ResizeAndOverwrite)
+{
+  s21::s21_vector<char> v = {'>', ' '};
+
+  v.resize_and_overwrite(64, [](char *data, size_t count) {
+    EXPECT_EQ(count, 64);
+    std::memcpy(data + 2, "payload", 7);
+    return 9;
+  });
+
+  EXPECT_EQ(v.size(), 9);
+  EXPECT_EQ(v[0], '>');
+  EXPECT_EQ(std::string(v.data(), v.size()), "> payload");
+}
+
+TEST(VectorTest, SizeValueConstructor)
+{
+  s21::s21_vector<std::string> v(3, "x");
+
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[2], "x");
+}
+
+#ifdef __cpp_lib_constexpr_dynamic_alloc
+namespace {
+constexpr std::array<int, 10> SquaresTable()
+{
+  s21::s21_vector<int> v;
+  v.reserve(2);
+  for (int i = 0; i < 10; ++i) {
+    v.push_back(i * i);
+  }
+  v.insert(v.cbegin(), -1);
+  v.erase(v.cbegin());
+  std::array<int, 10> table{};
+  std::copy(v.begin(), v.end(), table.begin());
+  return table;
+}
+
+constexpr std::size_t GrowAndShrink()
+{
+  s21::s21_vector<s21::s21_vector<int>> nested(3, s21::s21_vector<int>{1, 2});
+  nested.emplace_back(5, 7);
+  nested.resize(2);
+  nested.shrink_to_fit();
+  return nested.capacity() + nested.back().size() + nested.at(1)[1];
+}
+}
+
+TEST(VectorTest, Constexpr)
+{
+  constexpr std::array<int, 10> table = SquaresTable();
+  static_assert(table[9] == 81);
+  static_assert(GrowAndShrink() == 6);
+
+  EXPECT_EQ(table[3], 9);
+}
+#endif
+
+TEST(VectorTest, BoolIsBitPacked)
+{
+  s21::s21_vector<bool> v(130, true);
+
+  v.push_back(false);
+  v[3] = false;
+  v.back() = v[0];
+
+  EXPECT_EQ(v.size(), 131);
+  EXPECT_EQ(v.capacity() % 64, 0);
+  EXPECT_EQ(v.count(), 130);
+  EXPECT_FALSE(v[3]);
+  EXPECT_TRUE(v.at(130));
+  EXPECT_EQ(v.data()[2], 0x7ull);
+  EXPECT_THROW(v.at(131), std::out_of_range);
+
+  v.resize(65);
+
+  EXPECT_EQ(v.count(), 64);
+  EXPECT_EQ(v.data()[1], 1ull);
+}
+
+TEST(VectorTest, BoolFindAndRanges)
+{
+  s21::s21_vector<bool> v(1000);
+
+  EXPECT_EQ(v.find_first(), s21::s21_vector<bool>::npos);
+  EXPECT_TRUE(v.none());
+
+  v.set(60, 200);
+  v.reset(100, 10);
+  v[999] = true;
+
+  EXPECT_EQ(v.count(), 191);
+  EXPECT_EQ(v.find_first(), 60);
+  EXPECT_EQ(v.find_next(99), 110);
+  EXPECT_EQ(v.find_next(259), 999);
+  EXPECT_EQ(v.find_next(999), s21::s21_vector<bool>::npos);
+  EXPECT_THROW(v.set(990, 11), std::out_of_range);
+
+  v.flip();
+
+  EXPECT_EQ(v.count(), 809);
+  EXPECT_FALSE(v.all());
+  EXPECT_TRUE(v.set().all());
+  EXPECT_EQ(v.reset().count(), 0);
+}
+
+TEST(VectorTest, BoolIteratorsAndCopies)
+{
+  s21::s21_vector<bool> v = {true, false, true, true};
+  s21::s21_vector<bool> copy(v);
+  s21::s21_vector<bool> moved(std::move(v));
+
+  for (auto bit : copy) {
+    bit = !bit;
+  }
+  const s21::s21_vector<bool> &cv = moved;
+
+  EXPECT_EQ(std::count(cv.begin(), cv.end(), true), 3);
+  EXPECT_EQ(std::count(copy.begin(), copy.end(), true), 1);
+  EXPECT_EQ(*(copy.cbegin() + 1), true);
+  EXPECT_EQ(copy.end() - copy.cbegin(), 4);
+  EXPECT_EQ(*moved.rbegin(), true);
+  EXPECT_EQ(v.size(), 0);
+
+  copy.pop_back();
+  copy.swap(moved);
+
+  EXPECT_EQ(copy.size(), 4);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_EQ(moved.count(), 1);
+}
+
+TEST(VectorTest, EraseRange)
+{
+  s21::s21_vector<std::string> v = {"a", "b", "c", "d", "e", "f"};
+
+  auto it = v.erase(v.cbegin() + 1, v.cbegin() + 4);
+  EXPECT_EQ(*it, "e");
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[2], "f");
+
+  it = v.erase(v.cbegin() + 1, v.cbegin() + 1);
+  EXPECT_EQ(*it, "e");
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_THROW(v.erase(v.cbegin() + 2, v.cbegin() + 1), std::out_of_range);
+
+  v.erase(v.cbegin(), v.cend());
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(VectorTest, EraseIfAndIndices)
+{
+  s21::s21_vector<std::string> words;
+  s21::s21_vector<int> numbers;
+  for (int i = 0; i < 100; ++i) {
+    words.push_back(std::to_string(i));
+    numbers.push_back(i);
+  }
+
+  EXPECT_EQ(s21::erase_if(words, [](const std::string &w) { return w.size() == 2 && w[1] == '0'; }), 9);
+  EXPECT_EQ(words.size(), 91);
+  EXPECT_EQ(words[10], "11");
+  EXPECT_EQ(s21::erase(words, std::string("99")), 1);
+  EXPECT_EQ(s21::erase(words, std::string("99")), 0);
+  EXPECT_EQ(words.back(), "98");
+
+  s21::s21_vector<std::size_t> indices = {0, 5, 5, 6, 99};
+  EXPECT_EQ(s21::erase_indices(numbers, indices), 4);
+  EXPECT_EQ(numbers.size(), 96);
+  EXPECT_EQ(numbers[0], 1);
+  EXPECT_EQ(numbers[4], 7);
+  EXPECT_EQ(numbers.back(), 98);
+
+  std::vector<int> unsorted = {3, 1};
+  EXPECT_THROW(s21::erase_indices(numbers, unsorted), std::invalid_argument);
+  std::vector<int> too_far = {1, 96};
+  EXPECT_THROW(s21::erase_indices(numbers, too_far), std::out_of_range);
+  std::vector<int> negative = {-1, 2};
+  EXPECT_THROW(s21::erase_indices(numbers, negative), std::out_of_range);
+  EXPECT_EQ(numbers.size(), 96);
+  EXPECT_EQ(numbers[0], 1);
+  EXPECT_EQ(s21::erase_indices(numbers, std::vector<int>()), 0);
+
+  s21::s21_vector<bool> bits = {true, false, true, true, false, true};
+  EXPECT_EQ(s21::erase_if(bits, [](bool bit) { return !bit; }), 2);
+  EXPECT_EQ(bits.size(), 4);
+  EXPECT_TRUE(bits.all());
+  bits.erase(bits.cbegin() + 1, bits.cend());
+  EXPECT_EQ(bits.size(), 1);
+}
+
+//__________________<<VECTOR<<____________________
+
+//__________________>>SMALL_VECTOR>>______________
+
+TEST(SmallVectorTest, StaysInline)
+{
+  int allocations = 0;
+  CountingAllocator<int> alloc(&allocations);
+  s21::s21_small_vector<int, 4, CountingAllocator<int>> v(alloc);
+
+  v.push_back(1);
+  v.insert_many_back(2, 3, 4);
+
+  EXPECT_EQ(allocations, 0);
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 4);
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[3], 4);
+}
+
+TEST(SmallVectorTest, SpillsToHeap)
+{
+  int allocations = 0;
+  CountingAllocator<std::string> alloc(&allocations);
+  s21::s21_small_vector<std::string, 2, CountingAllocator<std::string>> v({"a", "b"}, alloc);
+
+  v.push_back("c");
+  v.insert(v.begin(), "z");
+
+  EXPECT_EQ(allocations, 1);
+  EXPECT_FALSE(v.is_inline());
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v[0], "z");
+  EXPECT_EQ(v[3], "c");
+
+  v.erase(v.begin());
+  v.pop_back();
+  v.shrink_to_fit();
+
+  EXPECT_TRUE(v.is_inline());
+  EXPECT_EQ(v.capacity(), 2);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v[1], "b");
+
+  EXPECT_THROW(v.reserve(v.max_size() + 1), std::length_error);
+  EXPECT_THROW(v.insert(v.cend(), v.max_size(), "x"), std::length_error);
+  EXPECT_EQ(v.size(), 2);
+}
+
+TEST(SmallVectorTest, MoveAndSwap)
+{
+  s21::s21_small_vector<std::string, 2> small = {"a"};
+  s21::s21_small_vector<std::string, 2> big = {"b", "c", "d"};
+
+  small.swap(big);
+
+  EXPECT_EQ(small.size(), 3);
+  EXPECT_EQ(small[2], "d");
+  EXPECT_EQ(big.size(), 1);
+  EXPECT_EQ(big[0], "a");
+  EXPECT_TRUE(big.is_inline());
+
+  s21::s21_small_vector<std::string, 2> moved(std::move(small));
+
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_EQ(small.size(), 0);
+  EXPECT_TRUE(small.is_inline());
+}
+
+TEST(SmallVectorTest, Copy)
+{
+  s21::s21_small_vector<int, 3> v1 = {1, 2, 3, 4};
+  s21::s21_small_vector<int, 3> v2(v1);
+  s21::s21_small_vector<int, 3> v3;
+
+  v3 = v1;
+
+  EXPECT_EQ(v2.size(), 4);
+  EXPECT_EQ(v3.size(), 4);
+  EXPECT_EQ(v2[3], 4);
+  EXPECT_EQ(v3[0], 1);
+}
+
+TEST(SmallVectorTest, PmrResourcesStayApart)
+{
+  using pmr_small_vector = s21::s21_small_vector<std::string, 2, std::pmr::polymorphic_allocator<std::string>>;
+  TrackingResource first;
+  TrackingResource second;
+  pmr_small_vector v1({"a", "b", "c"}, &first);
+  pmr_small_vector v2({"d", "e", "f", "g"}, &second);
+  pmr_small_vector v3({"h"}, &second);
+
+  v1.swap(v2);
+  EXPECT_EQ(v1.size(), 4);
+  EXPECT_EQ(v1[3], "g");
+  EXPECT_EQ(v2[2], "c");
+
+  v2.swap(v3);
+  EXPECT_EQ(v2.size(), 1);
+  EXPECT_EQ(v3[0], "a");
+
+  v1 = std::move(v3);
+  EXPECT_EQ(v1.size(), 3);
+  EXPECT_EQ(v1[2], "c");
+  EXPECT_EQ(v1.get_allocator().resource(), &first);
+
+  v3 = v1;
+  EXPECT_EQ(v3.size(), 3);
+  EXPECT_EQ(v3.get_allocator().resource(), &second);
+}
+
+//__________________<<SMALL_VECTOR<<______________
+
+//__________________>>COMPACT_VECTOR>>____________
+
+TEST(CompactVectorTest, SixteenByteHeader)
+{
+  static_assert(sizeof(s21::compact_vector<int>) == 16, "two 32-bit counts after the pointer");
+  static_assert(sizeof(s21::thin_vector<int>) == sizeof(void*), "just the block pointer");
+
+  s21::compact_vector<std::string> v = {"b", "c"};
+  v.insert(v.cbegin(), "a");
+  for (int i = 0; i < 100; ++i) {
+    v.push_back(std::to_string(i));
+  }
+  v.erase(v.cbegin() + 1);
+
+  EXPECT_EQ(v.size(), 102u);
+  EXPECT_EQ(v[1], "c");
+  EXPECT_EQ(v.back(), "99");
+  EXPECT_EQ(v.max_size(), std::numeric_limits<uint32_t>::max() / sizeof(std::string) / 2);
+  EXPECT_THROW(v.reserve(v.max_size() + 1), std::length_error);
+
+  s21::compact_vector<char, uint16_t> small;
+  EXPECT_EQ(small.max_size(), 32767u);
+  small.resize(32767, 'x');
+  EXPECT_THROW(small.push_back('y'), std::length_error);
+  EXPECT_EQ(small.size(), 32767u);
+}
+
+TEST(CompactVectorTest, NarrowSizeTypeRejectsLongRanges)
+{
+  std::vector<char> source(70000, 'z');  // wraps to 4464 in 16 bits
+  s21::compact_vector<char, uint16_t> v = {'a'};
+
+  EXPECT_THROW(v.insert(v.cbegin(), source.begin(), source.end()), std::length_error);
+  EXPECT_THROW(v.append_range(source.begin(), source.end()), std::length_error);
+  EXPECT_EQ(v.size(), 1u);
+  EXPECT_EQ(v[0], 'a');
+  using narrow_vector = s21::compact_vector<char, uint16_t>;
+  EXPECT_THROW(narrow_vector(source.begin(), source.end()), std::length_error);
+  EXPECT_THROW((s21::thin_vector<char, uint16_t>(source.begin(), source.end())), std::length_error);
+
+  s21::thin_vector<char, uint16_t> thin(65000, 'x');
+  EXPECT_THROW(thin.insert(thin.cend(), source.begin(), source.begin() + 800), std::length_error);
+  EXPECT_EQ(thin.size(), 65000u);
+}
+
+TEST(ThinVectorTest, HeaderLivesInTheBlock)
+{
+  int allocations = 0;
+  CountingAllocator<std::string> alloc(&allocations);
+  s21::thin_vector<std::string, uint32_t, CountingAllocator<std::string>> v(alloc);
+
+  EXPECT_TRUE(v.empty());
+  EXPECT_EQ(v.capacity(), 0u);
+  EXPECT_EQ(v.data(), nullptr);
+  EXPECT_EQ(v.begin(), v.end());
+  EXPECT_EQ(allocations, 0);
+
+  v.push_back("b");
+  v.insert(v.cbegin(), "a");
+  v.emplace(v.cend(), 3, 'c');
+  EXPECT_EQ(v.size(), 3u);
+  EXPECT_EQ(v[0], "a");
+  EXPECT_EQ(v.at(2), "ccc");
+  EXPECT_THROW(v.at(3), std::out_of_range);
+
+  std::string more[] = {"d", "e", "f", "g", "h"};
+  v.insert(v.cbegin() + 1, std::begin(more), std::end(more));
+  v.erase(v.cbegin());
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), std::vector<std::string>{"d", "e", "f", "g", "h", "b", "ccc"}.begin()));
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data()) % alignof(std::string), 0u);
+
+  v.resize(2);
+  v.shrink_to_fit();
+  EXPECT_EQ(v.capacity(), 2u);
+  v.clear();
+  v.shrink_to_fit();
+  EXPECT_EQ(v.data(), nullptr);
+}
+
+TEST(ThinVectorTest, CopyMoveAndSwap)
+{
+  s21::thin_vector<double> empty;
+  s21::thin_vector<double> v(3, 1.5);
+  s21::thin_vector<double> copy(v);
+  copy.push_back(2.5);
+
+  EXPECT_EQ(copy.size(), 4u);
+  EXPECT_EQ(v.size(), 3u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(v.data()) % alignof(double), 0u);
+
+  s21::thin_vector<double> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.back(), 2.5);
+
+  moved.swap(empty);
+  EXPECT_TRUE(moved.empty());
+  EXPECT_EQ(empty.size(), 4u);
+
+  v = empty;
+  moved = std::move(v);
+  EXPECT_EQ(moved.size(), 4u);
+  EXPECT_EQ(moved[3], 2.5);
+  EXPECT_EQ(s21::thin_vector<double>::block_bytes(4), 8 + 4 * sizeof(double));
+}
+
+TEST(ThinVectorTest, AllocatorPropagation)
+{
+  using propagating_vector = s21::thin_vector<std::string, uint32_t, PropagatingAllocator<std::string>>;
+  int first = 0;
+  int second = 0;
+  PropagatingAllocator<std::string> first_alloc(&first);
+  PropagatingAllocator<std::string> second_alloc(&second);
+  propagating_vector v1({"a", "b"}, first_alloc);
+  propagating_vector v2({"c"}, second_alloc);
+
+  v1 = std::move(v2);  // takes the block and the allocator, nothing is allocated
+  EXPECT_EQ(first, 1);
+  EXPECT_EQ(second, 1);
+  EXPECT_EQ(v1.size(), 1u);
+  EXPECT_EQ(v1[0], "c");
+  EXPECT_TRUE(v1.get_allocator() == second_alloc);
+
+  propagating_vector v3({"d", "e", "f"}, first_alloc);
+  v3 = v1;
+  EXPECT_TRUE(v3.get_allocator() == second_alloc);
+  EXPECT_EQ(second, 2);
+  EXPECT_EQ(v3.size(), 1u);
+
+  propagating_vector v4({"g"}, first_alloc);
+  v4.swap(v3);
+  EXPECT_TRUE(v4.get_allocator() == second_alloc);
+  EXPECT_TRUE(v3.get_allocator() == first_alloc);
+  EXPECT_EQ(v3[0], "g");
+}
+
+//__________________<<COMPACT_VECTOR<<____________
+
+//__________________>>GAP_VECTOR>>________________
+
+TEST(GapVectorTest, EditsAtTheCursor)
+{
+  s21::gap_vector<char> text;
+  text.reserve(32);
+  std::string typed = "hello world";
+  text.insert(text.cend(), typed.begin(), typed.end());
+  EXPECT_EQ(text.gap_position(), 11u);
+
+  text.move_gap(5);
+  EXPECT_EQ(text.gap_position(), 5u);
+  EXPECT_EQ(text[5], ' ');
+  EXPECT_EQ(text.back(), 'd');
+
+  std::size_t capacity = text.capacity();
+  text.insert(text.cbegin() + 5, ',');
+  text.erase(text.cbegin() + 4);  // backspace over the 'o'
+  text.insert(text.cbegin() + 4, '0');
+  EXPECT_EQ(text.capacity(), capacity);
+  EXPECT_EQ(std::string(text.begin(), text.end()), "hell0, world");
+
+  text.erase(text.cbegin() + 6, text.cend());
+  text.push_back('!');
+  text.insert(text.cbegin(), 2, '>');
+  EXPECT_EQ(std::string(text.begin(), text.end()), ">>hell0,!");
+  EXPECT_EQ(std::string(text.rbegin(), text.rend()), "!,0lleh>>");
+  EXPECT_THROW(text.move_gap(10), std::out_of_range);
+  EXPECT_THROW(text.at(9), std::out_of_range);
+
+  text.shrink_to_fit();
+  EXPECT_EQ(text.gap_size(), 0u);
+  EXPECT_EQ(text.capacity(), 9u);
+  EXPECT_EQ(text.at(2), 'h');
+}
+
+TEST(GapVectorTest, MatchesStdVector)
+{
+  s21::gap_vector<std::string> gap = {"a", "b", "c"};
+  std::vector<std::string> expected = {"a", "b", "c"};
+  std::size_t cursor = 1;
+  for (int i = 0; i < 2000; ++i) {
+    std::size_t r = (i * 2654435761u) >> 4;
+    cursor = r % 16 == 0 ? r % (expected.size() + 1) : std::min(cursor + r % 3, expected.size());
+    if (r % 5 < 3 || expected.empty()) {
+      gap.insert(gap.cbegin() + cursor, std::to_string(i));
+      expected.insert(expected.begin() + cursor, std::to_string(i));
+      ++cursor;
+    } else if (cursor > 0) {
+        gap.erase(gap.cbegin() + --cursor);
+        expected.erase(expected.begin() + cursor);
+    }
+  }
+  gap.emplace(gap.cbegin() + 1, gap[0]);
+  expected.emplace(expected.begin() + 1, expected[0]);
+
+  EXPECT_EQ(gap.size(), expected.size());
+  EXPECT_TRUE(std::equal(gap.begin(), gap.end(), expected.begin(), expected.end()));
+
+  s21::gap_vector<std::string> copy(gap);
+  s21::gap_vector<std::string> moved(std::move(gap));
+  EXPECT_TRUE(gap.empty());
+  EXPECT_EQ(copy.gap_position(), copy.size());
+  EXPECT_TRUE(std::equal(moved.begin(), moved.end(), copy.begin(), copy.end()));
+
+  moved.resize(3);
+  copy = moved;
+  EXPECT_EQ(copy.size(), 3u);
+  EXPECT_EQ(copy.front(), expected[0]);
+  EXPECT_EQ(copy.back(), expected[2]);
+}
+
+TEST(GapVectorTest, PmrResourcesStayApart)
+{
+  using pmr_gap_vector = s21::gap_vector<std::string, std::pmr::polymorphic_allocator<std::string>>;
+  TrackingResource first;
+  TrackingResource second;
+  pmr_gap_vector v1({"a", "b", "c"}, &first);
+  pmr_gap_vector v2({"d"}, &second);
+
+  v1.insert(v1.cbegin() + 1, "x");
+  v1.swap(v2);
+  EXPECT_EQ(v1.size(), 1);
+  EXPECT_EQ(v2.size(), 4);
+  EXPECT_EQ(v2[1], "x");
+
+  v1 = std::move(v2);
+  EXPECT_EQ(v1.size(), 4);
+  EXPECT_EQ(v1[3], "c");
+  EXPECT_EQ(v1.get_allocator().resource(), &first);
+
+  v2 = v1;
+  v2.insert(v2.cbegin(), "y");
+  EXPECT_EQ(v2.size(), 5);
+  EXPECT_EQ(v2[4], "c");
+  EXPECT_EQ(v2.get_allocator().resource(), &second);
+}
+
+//__________________<<GAP_VECTOR<<________________
+
+//__________________>>INCREMENTAL_VECTOR>>________
+
+TEST(IncrementalVectorTest, GrowsInSteps)
+{
+  s21::incremental_vector<int, 4> v;
+  for (int i = 0; i < 64; ++i) {
+    v.push_back(i);
+  }
+  EXPECT_FALSE(v.migrating());
+  EXPECT_EQ(v.capacity(), 64u);
+
+  v.push_back(64);
+  EXPECT_TRUE(v.migrating());
+  EXPECT_EQ(v.capacity(), 128u);
+  EXPECT_EQ(v.pending(), 64u);
+
+  v.push_back(v[0]);  // the argument may be an element that is about to move
+  EXPECT_EQ(v.pending(), 60u);
+  EXPECT_EQ(v.back(), 0);
+  for (int i = 0; i < 66; ++i) {
+    EXPECT_EQ(v.at(i), i < 65 ? i : 0);
+  }
+
+  v.pop_back();
+  EXPECT_EQ(v.pending(), 56u);
+  for (int i = 0; i < 14; ++i) {
+    v.push_back(65 + i);
+  }
+  EXPECT_FALSE(v.migrating());
+  EXPECT_EQ(v.size(), 79u);
+  for (int i = 0; i < 79; ++i) {
+    EXPECT_EQ(v.data()[i], i);
+  }
+  EXPECT_THROW(v.at(79), std::out_of_range);
+}
+
+TEST(IncrementalVectorTest, MatchesStdVector)
+{
+  s21::incremental_vector<std::string, 1, std::allocator<std::string>, s21::growth::one_and_half<>> v = {"a", "b"};
+  std::vector<std::string> expected = {"a", "b"};
+  for (int i = 0; i < 3000; ++i) {
+    if (i % 7 == 6) {
+      v.pop_back();
+      expected.pop_back();
+    } else {
+        v.push_back(std::to_string(i));
+        expected.push_back(std::to_string(i));
+    }
+    EXPECT_EQ(v.back(), expected.back());
+  }
+  EXPECT_TRUE(std::equal(v.begin(), v.end(), expected.begin(), expected.end()));
+
+  auto copy = v;
+  auto moved = std::move(v);
+  EXPECT_TRUE(v.empty());
+  EXPECT_FALSE(copy.migrating());
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), moved.begin(), moved.end()));
+  EXPECT_TRUE(std::equal(moved.rbegin(), moved.rend(), expected.rbegin(), expected.rend()));
+
+  moved.reserve(moved.capacity() + 1);
+  EXPECT_FALSE(moved.migrating());
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+}
+
+TEST(IncrementalVectorTest, PmrResourcesStayApart)
+{
+  using pmr_incremental_vector = s21::incremental_vector<std::string, 2, std::pmr::polymorphic_allocator<std::string>>;
+  TrackingResource first;
+  TrackingResource second;
+  pmr_incremental_vector v1(&first);
+  pmr_incremental_vector v2({"x"}, &second);
+  for (int i = 0; i < 9; ++i) {
+    v1.push_back(std::to_string(i));  // the last push leaves a migration half done
+  }
+
+  v1.swap(v2);
+  EXPECT_EQ(v1.size(), 1);
+  EXPECT_EQ(v2.size(), 9);
+  EXPECT_EQ(v2[0], "0");
+
+  v1 = std::move(v2);
+  EXPECT_EQ(v1.size(), 9);
+  EXPECT_EQ(v1[8], "8");
+  EXPECT_EQ(v1.get_allocator().resource(), &first);
+
+  v2 = v1;
+  v2.push_back("9");
+  EXPECT_EQ(v2.size(), 10);
+  EXPECT_EQ(v2[4], "4");
+  EXPECT_EQ(v2.get_allocator().resource(), &second);
+}
+
+//__________________<<INCREMENTAL_VECTOR<<________
+
+//__________________>>SIMD>>______________________
+
+namespace {
+
+template <typename T>
+void ExpectKernelsMatchScalar()
+{
+  for (std::size_t n = 0; n <= 37; ++n) {
+    s21::s21_vector<T> v;
+    for (std::size_t i = 0; i < n; ++i) {
+      v.push_back(static_cast<T>((i * 7 + 3) % 11));
+    }
+    const T *first = v.data();
+    const T *last = v.data() + v.size();
+    const T needles[] = {static_cast<T>(10), static_cast<T>(42)};
+
+    EXPECT_EQ(s21::simd::find(first, last, static_cast<T>(10)), s21::simd::scalar::find(first, last, static_cast<T>(10)));
+    EXPECT_EQ(s21::simd::count(first, last, static_cast<T>(3)), s21::simd::scalar::count(first, last, static_cast<T>(3)));
+    EXPECT_EQ(s21::simd::sum(first, last), s21::simd::scalar::sum(first, last));
+    EXPECT_EQ(s21::simd::contains_any(first, last, needles, 2), s21::simd::scalar::contains_any(first, last, needles, 2));
+    if (n) {
+      EXPECT_EQ(s21::simd::minmax(first, last), s21::simd::scalar::minmax(first, last));
+    }
+#ifdef S21_SIMD_X86
+    if constexpr (s21::simd::detail::vectorized<T>) {
+      if (__builtin_cpu_supports("sse4.2")) {
+        EXPECT_EQ(s21::simd::detail::sse42_find(first, last, static_cast<T>(10)), s21::simd::scalar::find(first, last, static_cast<T>(10)));
+        EXPECT_EQ(s21::simd::detail::sse42_count(first, last, static_cast<T>(3)), s21::simd::scalar::count(first, last, static_cast<T>(3)));
+        EXPECT_EQ(s21::simd::detail::sse42_sum(first, last), s21::simd::scalar::sum(first, last));
+        if (n) {
+          EXPECT_EQ(s21::simd::detail::sse42_minmax(first, last), s21::simd::scalar::minmax(first, last));
+        }
+      }
+    }
+#endif
+  }
+}
+
+}  // namespace
+
+TEST(SimdTest, KernelsMatchScalar)
+{
+  ExpectKernelsMatchScalar<std::int32_t>();
+  ExpectKernelsMatchScalar<std::uint32_t>();
+  ExpectKernelsMatchScalar<std::int64_t>();
+  ExpectKernelsMatchScalar<std::uint64_t>();
+  ExpectKernelsMatchScalar<float>();
+  ExpectKernelsMatchScalar<double>();
+  ExpectKernelsMatchScalar<short>();
+}
+
+TEST(SimdTest, SignedAndUnsignedExtremes)
+{
+  s21::s21_vector<std::int64_t> s = {5, INT64_MIN, -1, 7, INT64_MAX, 0, 3};
+  s21::s21_vector<std::uint64_t> u = {5, UINT64_MAX, 1, 7, 0, 1ULL << 63, 3};
+  s21::s21_vector<std::int32_t> i = {-4, -4, -4, -4, -4, -4, -4, -4, -4, 2000000000, 2000000000};
+
+  EXPECT_EQ(s21::simd::minmax(s), std::make_pair(INT64_MIN, INT64_MAX));
+  EXPECT_EQ(s21::simd::minmax(u), std::make_pair(std::uint64_t(0), UINT64_MAX));
+  EXPECT_EQ(s21::simd::sum(i), std::int64_t(4000000000) - 36);
+}
+
+TEST(SimdTest, VectorOverloads)
+{
+  s21::s21_vector<int> v = {4, 8, 15, 16, 23, 42, 8, 8, 1};
+  s21::s21_vector<int> empty;
+
+  EXPECT_EQ(s21::simd::find(v, 16) - v.cbegin(), 3);
+  EXPECT_EQ(s21::simd::find(v, 99), v.cend());
+  EXPECT_EQ(s21::simd::count(v, 8), 3u);
+  EXPECT_EQ(s21::simd::sum(v), 125);
+  EXPECT_EQ(s21::simd::minmax(v), std::make_pair(1, 42));
+  EXPECT_TRUE(s21::simd::contains_any(v, {100, 23}));
+  EXPECT_FALSE(s21::simd::contains_any(v, {100, 200}));
+  EXPECT_THROW(s21::simd::minmax(empty), std::out_of_range);
+}
+
+//__________________<<SIMD<<______________________
+
+//__________________>>MAPPED_VECTOR>>_____________
+
+TEST(MappedVectorTest, WriteAndReopen)
+{
+  std::string path = testing::TempDir() + "s21_mapped_vector_reopen";
+  {
+    s21::mapped_vector<std::uint64_t> v(path, s21::map_mode::create);
+    for (std::uint64_t i = 0; i < 5000; ++i) {
+      v.push_back(i * i);
+    }
+    v.flush();
+  }
+  s21::mapped_vector<std::uint64_t> writer(path);
+  writer.push_back(7);
+  writer.close();
+
+  const s21::mapped_vector<std::uint64_t> reader(path, s21::map_mode::read_only);
+
+  EXPECT_TRUE(reader.is_read_only());
+  EXPECT_EQ(reader.size(), 5001);
+  EXPECT_EQ(reader[4999], 4999ull * 4999ull);
+  EXPECT_EQ(reader.back(), 7);
+  EXPECT_EQ(*std::find(reader.begin(), reader.end(), 49), 49);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, ReadOnlyRefusesWrites)
+{
+  std::string path = testing::TempDir() + "s21_mapped_vector_read_only";
+  {
+    s21::mapped_vector<int> v(path, s21::map_mode::create);
+    v.resize(3, 5);
+  }
+  s21::mapped_vector<int> reader(path, s21::map_mode::read_only);
+  s21::mapped_vector<int> closed;
+
+  EXPECT_THROW(reader.push_back(1), std::logic_error);
+  EXPECT_THROW(reader.resize(10), std::logic_error);
+  EXPECT_THROW(closed.push_back(1), std::logic_error);
+  EXPECT_THROW(reader.at(3), std::out_of_range);
+  EXPECT_EQ(reader.at(2), 5);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, HeaderChecks)
+{
+  std::string path = testing::TempDir() + "s21_mapped_vector_header";
+  {
+    s21::mapped_vector<int> v(path, s21::map_mode::create);
+    v.push_back(1);
+  }
+
+  EXPECT_THROW(s21::mapped_vector<double>(path, s21::map_mode::read_only), std::runtime_error);
+  EXPECT_THROW(s21::mapped_vector<int>(path + "_missing", s21::map_mode::read_only), std::system_error);
+
+  FILE *f = std::fopen(path.c_str(), "r+");
+  std::fputs("garbage", f);
+  std::fclose(f);
+
+  EXPECT_THROW(s21::mapped_vector<int>(path, s21::map_mode::read_write), std::runtime_error);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, GrowAndShrinkFile)
+{
+  std::string path = testing::TempDir() + "s21_mapped_vector_grow";
+  s21::mapped_vector<int> v(path, s21::map_mode::create);
+  int values[] = {1, 2, 3, 4};
+
+  v.reserve(100000);
+  v.append_range(values, values + 4);
+  v.push_back(v[0]);
+  struct stat st;
+  stat(path.c_str(), &st);
+
+  EXPECT_GE(v.capacity(), 100000);
+  EXPECT_EQ(static_cast<std::size_t>(st.st_size), 64 + v.capacity() * sizeof(int));
+
+  v.shrink_to_fit();
+  stat(path.c_str(), &st);
+
+  EXPECT_LT(v.capacity(), 100000);
+  EXPECT_EQ(static_cast<std::size_t>(st.st_size), 64 + v.capacity() * sizeof(int));
+  EXPECT_EQ(v.size(), 5);
+  EXPECT_EQ(v[4], 1);
+
+  s21::mapped_vector<int> moved(std::move(v));
+
+  EXPECT_FALSE(v.is_open());
+  EXPECT_EQ(moved.back(), 1);
+  std::remove(path.c_str());
+}
+
+TEST(MappedVectorTest, PartialTrailingElement)
+{
+  std::string path = testing::TempDir() + "s21_mapped_vector_partial";
+  {
+    s21::mapped_vector<int> v(path, s21::map_mode::create);
+    v.push_back(3);
+  }
+  ASSERT_EQ(truncate(path.c_str(), 4096 + 2), 0);  // the mapping ends two bytes into a second page
+
+  s21::mapped_vector<int> v(path);
+  EXPECT_EQ(v.capacity(), (4096 - 64) / sizeof(int));
+  v.flush();
+  for (int i = 0; i < 2000; ++i) {
+    v.push_back(i);
+  }
+  v.flush();
+  v.close();
+
+  s21::mapped_vector<int> reader(path, s21::map_mode::read_only);
+  EXPECT_EQ(reader.size(), 2001);
+  EXPECT_EQ(reader[0], 3);
+  EXPECT_EQ(reader.back(), 1999);
+  std::remove(path.c_str());
+}
+
+//__________________<<MAPPED_VECTOR<<_____________
+
+//__________________>>SOA_VECTOR>>________________
+
+namespace {
+struct ThrowOnCopy
+{
+  int value;
+
+  ThrowOnCopy(int v = 0) : value(v) {}
+  ThrowOnCopy(const ThrowOnCopy &other) : value(other.value)
+  {
+    if (value < 0) {
+      throw std::runtime_error("ThrowOnCopy");
+    }
+  }
+  ThrowOnCopy &operator=(const ThrowOnCopy &other) = default;
+};
+}
+
+TEST(SoaVectorTest, RowsAndColumns)
+{
+  s21::soa_vector<int, double, std::string> v = {{1, 1.5, "a"}, {2, 2.5, "b"}};
+
+  v.push_back({3, 3.5, "c"});
+  v.emplace_back(4, 4.5, "d");
+
+  EXPECT_EQ(v.size(), 4);
+  EXPECT_EQ(v.capacity(), v.column<2>().capacity());
+  EXPECT_EQ(std::get<2>(v[2]), "c");
+  EXPECT_EQ(v.get<1>(3), 4.5);
+  EXPECT_EQ(v.data<0>()[1], 2);
+  EXPECT_EQ(s21::simd::sum(v.column<0>()), 10);
+  EXPECT_THROW(v.at(4), std::out_of_range);
+
+  std::get<0>(v.back()) = 40;
+  v.erase(v.cbegin() + 1);
+
+  EXPECT_EQ(v.size(), 3);
+  EXPECT_EQ(v.get<2>(1), "c");
+  EXPECT_EQ(v.get<0>(2), 40);
+}
+
+TEST(SoaVectorTest, RowIterator)
+{
+  s21::soa_vector<int, char> v(3);
+  int i = 0;
+
+  for (auto [number, letter] : v) {
+    number = i;
+    letter = static_cast<char>('a' + i++);
+  }
+  const s21::soa_vector<int, char> &cv = v;
+
+  EXPECT_EQ(cv.end() - cv.begin(), 3);
+  EXPECT_EQ(v.end() - v.cbegin(), 3);
+  EXPECT_TRUE(v.begin() + 3 == cv.end());
+  EXPECT_EQ(std::get<1>(cv.begin()[2]), 'c');
+  EXPECT_EQ(std::get<0>(*--v.end()), 2);
+  EXPECT_EQ(std::count_if(cv.begin(), cv.end(), [](auto row) { return std::get<0>(row) > 0; }), 2);
+}
+
+TEST(SoaVectorTest, PushBackOwnRowAndMove)
+{
+  s21::soa_vector<std::string, int> v;
+
+  v.push_back({"first", 1});
+  for (int j = 0; j < 10; ++j) {
+    v.push_back(v[0]);
+  }
+  s21::soa_vector<std::string, int> moved(std::move(v));
+
+  EXPECT_EQ(moved.size(), 11);
+  EXPECT_EQ(moved.get<0>(10), "first");
+  EXPECT_EQ(v.size(), 0);
+}
+
+TEST(SoaVectorTest, FailedRowIsRolledBack)
+{
+  s21::soa_vector<int, ThrowOnCopy> v;
+  v.reserve(4);
+  ThrowOnCopy bad(-1);
+
+  v.emplace_back(1, ThrowOnCopy(1));
+
+  EXPECT_THROW(v.emplace_back(2, bad), std::runtime_error);
+  EXPECT_EQ(v.size(), 1);
+  EXPECT_EQ(v.column<0>().size(), 1);
+  EXPECT_EQ(v.column<1>().size(), 1);
+}
+
+//__________________<<SOA_VECTOR<<________________
+
+//__________________>>CONCURRENT_VECTOR>>_________
+
+TEST(ConcurrentVectorTest, SegmentsNeverMove)
+{
+  s21::concurrent_vector<std::string> v;
+
+  v.push_back("first");
+  const std::string *first = &v[0];
+  for (int i = 1; i < 1000; ++i) {
+    v.emplace_back(std::to_string(i));
+  }
+  auto it = v.grow_by(3, std::string("x"));
+
+  EXPECT_EQ(&v[0], first);
+  EXPECT_EQ(v.size(), 1003);
+  EXPECT_GE(v.capacity(), 1003);
+  EXPECT_EQ(v[999], "999");
+  EXPECT_EQ(it - v.begin(), 1000);
+  EXPECT_EQ(*(v.cend() - 1), "x");
+  EXPECT_THROW(v.at(1003), std::out_of_range);
+  EXPECT_EQ(std::count(v.cbegin(), v.cend(), "x"), 3);
+
+  v.clear();
+
+  EXPECT_TRUE(v.empty());
+}
+
+TEST(ConcurrentVectorTest, ConcurrentWritersAndReader)
+{
+  s21::concurrent_vector<std::uint64_t> v;
+  const std::uint64_t per_thread = 20000;
+  std::vector<std::thread> writers;
+  std::atomic<bool> done(false);
+  bool reader_ok = true;
+
+  std::thread reader([&] {
+    while (!done.load()) {
+      std::size_t n = v.size();
+      for (std::size_t j = 0; j < n; ++j) {
+        reader_ok = reader_ok && v[j] % per_thread < per_thread && v[j] != 0xdeadbeef;
+      }
+    }
+  });
+  for (std::uint64_t t = 0; t < 4; ++t) {
+    writers.emplace_back([&v, t, per_thread] {
+      for (std::uint64_t i = 0; i < per_thread; ++i) {
+        if (i % 100 == 0) {
+          v.grow_by(1, t * per_thread + i);
+        } else {
+            v.push_back(t * per_thread + i);
+        }
+      }
+    });
+  }
+  for (std::thread &writer : writers) {
+    writer.join();
+  }
+  done = true;
+  reader.join();
+  std::vector<std::uint64_t> values(v.begin(), v.end());
+  std::sort(values.begin(), values.end());
+
+  EXPECT_TRUE(reader_ok);
+  EXPECT_EQ(values.size(), 4 * per_thread);
+  EXPECT_EQ(std::adjacent_find(values.begin(), values.end()), values.end());
+}
+
+//__________________<<CONCURRENT_VECTOR<<_________
+
+//__________________>>SERIALIZE>>_________________
+
+TEST(SerializeTest, VectorsThroughFileDescriptor)
+{
+  FILE *file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  int fd = fileno(file);
+  s21::s21_vector<int> numbers;
+  for (int i = 0; i < 1000; ++i) {
+    numbers.push_back(i * 7);
+  }
+  s21::s21_vector<std::string> words = {"alpha", "", "a string long enough to live on the heap"};
+  s21::serialize(fd, numbers);
+  s21::serialize(fd, words);
+  s21::serialize(fd, s21::s21_vector<int>());
+  EXPECT_EQ(lseek(fd, 0, SEEK_CUR), static_cast<off_t>(3 * sizeof(s21::serial_header) + 1000 * sizeof(int) + 3 * 8 + 5 + 40));
+  lseek(fd, 0, SEEK_SET);
+
+  s21::s21_vector<int> numbers_back = {1, 2, 3};
+  s21::s21_vector<std::string> words_back;
+  s21::s21_vector<int> empty_back = {4};
+  s21::deserialize(fd, numbers_back);
+  s21::deserialize(fd, words_back);
+  s21::deserialize(fd, empty_back);
+  EXPECT_TRUE(std::equal(numbers_back.begin(), numbers_back.end(), numbers.begin(), numbers.end()));
+  EXPECT_TRUE(std::equal(words_back.begin(), words_back.end(), words.begin(), words.end()));
+  EXPECT_TRUE(empty_back.empty());
+  EXPECT_THROW(s21::deserialize(fd, numbers_back), std::runtime_error);
+  EXPECT_TRUE(numbers_back.empty());
+  std::fclose(file);
+}
+
+TEST(SerializeTest, MemoryRecordsAndViews)
+{
+  s21::s21_vector<double> values = {0.5, -1.25, 3.0};
+  s21::Set<int> set = {5, 1, 3};
+  s21::Map<int, std::string> map = {{2, "two"}, {1, "one"}};
+  s21::list<char> list = {'a', 'b', 'c'};
+  s21::s21_stack<int> stack = {1, 2, 3};
+  s21::s21_queue<std::string> queue = {"first", "second"};
+  s21::s21_vector<s21::s21_vector<int>> nested = {{1, 2}, {}, {3}};
+
+  s21::serial_buffer buffer;
+  s21::serialize(values, buffer);
+  EXPECT_EQ(buffer.size(), sizeof(s21::serial_header) + 3 * sizeof(double));
+  s21::serialize(set, buffer);
+  s21::serialize(map, buffer);
+  s21::serialize(list, buffer);
+  s21::serialize(stack, buffer);
+  s21::serialize(queue, buffer);
+  s21::serialize(nested, buffer);
+
+  s21::serial_view<double> view(buffer.data(), buffer.size());
+  ASSERT_EQ(view.size(), 3U);
+  EXPECT_EQ(static_cast<const void*>(view.data()), buffer.data() + sizeof(s21::serial_header));
+  EXPECT_EQ(view[1], -1.25);
+  EXPECT_THROW(view.at(3), std::out_of_range);
+
+  s21::s21_vector<double> values_back;
+  s21::Set<int> set_back;
+  s21::Map<int, std::string> map_back;
+  s21::list<char> list_back;
+  s21::s21_stack<int> stack_back;
+  s21::s21_queue<std::string> queue_back;
+  s21::s21_vector<s21::s21_vector<int>> nested_back;
+  std::size_t offset = 0;
+  offset += s21::deserialize(buffer.data() + offset, buffer.size() - offset, values_back);
+  offset += s21::deserialize(buffer.data() + offset, buffer.size() - offset, set_back);
+  offset += s21::deserialize(buffer.data() + offset, buffer.size() - offset, map_back);
+  offset += s21::deserialize(buffer.data() + offset, buffer.size() - offset, list_back);
+  offset += s21::deserialize(buffer.data() + offset, buffer.size() - offset, stack_back);
+  offset += s21::deserialize(buffer.data() + offset, buffer.size() - offset, queue_back);
+  offset += s21::deserialize(buffer.data() + offset, buffer.size() - offset, nested_back);
+  EXPECT_EQ(offset, buffer.size());
+
+  EXPECT_TRUE(std::equal(values_back.begin(), values_back.end(), values.begin(), values.end()));
+  EXPECT_EQ(set_back.size(), 3U);
+  EXPECT_TRUE(set_back.contains(1) && set_back.contains(3) && set_back.contains(5));
+  EXPECT_EQ(map_back.at(1), "one");
+  EXPECT_EQ(map_back.at(2), "two");
+  EXPECT_EQ(list_back.front(), 'a');
+  EXPECT_EQ(list_back.back(), 'c');
+  EXPECT_EQ(stack_back.size(), 3U);
+  EXPECT_EQ(stack_back.top(), 3);
+  stack_back.pop();
+  EXPECT_EQ(stack_back.top(), 2);
+  EXPECT_EQ(queue_back.front(), "first");
+  EXPECT_EQ(queue_back.back(), "second");
+  ASSERT_EQ(nested_back.size(), 3U);
+  EXPECT_TRUE(std::equal(nested_back[0].begin(), nested_back[0].end(), nested[0].begin(), nested[0].end()));
+  EXPECT_TRUE(nested_back[1].empty());
+  EXPECT_TRUE(std::equal(nested_back[2].begin(), nested_back[2].end(), nested[2].begin(), nested[2].end()));
+}
+
+TEST(SerializeTest, RejectsMismatchedRecords)
+{
+  s21::serial_buffer buffer;
+  s21::serialize(s21::s21_vector<int>{1, 2, 3}, buffer);
+
+  s21::Set<int> set = {7};
+  EXPECT_THROW(s21::deserialize(buffer.data(), buffer.size(), set), std::runtime_error);
+  s21::s21_vector<long long> wider;
+  EXPECT_THROW(s21::deserialize(buffer.data(), buffer.size(), wider), std::runtime_error);
+  EXPECT_THROW(s21::serial_view<float>(buffer.data(), buffer.size()), std::runtime_error);
+  s21::s21_vector<int> truncated = {9};
+  EXPECT_THROW(s21::deserialize(buffer.data(), buffer.size() - 1, truncated), std::runtime_error);
+  EXPECT_TRUE(truncated.empty());
+
+  s21::list<std::string> list;
+  list.push_back("abc");
+  s21::serial_buffer strings;
+  s21::serialize(list, strings);
+  strings[sizeof(s21::serial_header)] = 200;  // the length now runs past the end of the payload
+  EXPECT_THROW(s21::deserialize(strings.data(), strings.size(), list), std::runtime_error);
+  EXPECT_TRUE(list.empty());
+}
+
+TEST(SerializeTest, RejectsOversizedHeaders)
+{
+  s21::serial_buffer buffer;
+  s21::serialize(s21::s21_vector<int>{1, 2, 3}, buffer);
+  s21::serial_header header;
+  std::memcpy(&header, buffer.data(), sizeof(header));
+
+  FILE *file = std::tmpfile();
+  ASSERT_NE(file, nullptr);
+  int fd = fileno(file);
+  s21::serial_header huge = header;
+  huge.count = std::uint64_t(1) << 60;  // consistent with payload_size, but far beyond the file
+  huge.payload_size = huge.count * sizeof(int);
+  ASSERT_EQ(write(fd, &huge, sizeof(huge)), static_cast<ssize_t>(sizeof(huge)));
+  ASSERT_EQ(write(fd, buffer.data() + sizeof(header), 3 * sizeof(int)), static_cast<ssize_t>(3 * sizeof(int)));
+  lseek(fd, 0, SEEK_SET);
+  s21::s21_vector<int> target = {5};
+  EXPECT_THROW(s21::deserialize(fd, target), std::runtime_error);
+  EXPECT_TRUE(target.empty());
+  std::fclose(file);
+
+  int ends[2];
+  ASSERT_EQ(pipe(ends), 0);
+  huge.payload_size = ~std::uint64_t(0) - 3;  // more than any buffer holds; a pipe has no size to check against
+  huge.count = huge.payload_size / sizeof(int);
+  ASSERT_EQ(write(ends[1], &huge, sizeof(huge)), static_cast<ssize_t>(sizeof(huge)));
+  EXPECT_THROW(s21::deserialize(ends[0], target), std::runtime_error);
+  EXPECT_TRUE(target.empty());
+  close(ends[0]);
+  close(ends[1]);
+
+  s21::serial_buffer strings;
+  s21::serialize(s21::s21_vector<std::string>{"a"}, strings);
+  std::memcpy(&header, strings.data(), sizeof(header));
+  header.count = std::uint64_t(1) << 40;  // more elements than the payload has bytes
+  std::memcpy(strings.data(), &header, sizeof(header));
+  s21::s21_vector<std::string> words;
+  EXPECT_THROW(s21::deserialize(strings.data(), strings.size(), words), std::runtime_error);
+  EXPECT_TRUE(words.empty());
+
+  std::memcpy(&header, buffer.data(), sizeof(header));
+  header.count = 4;  // count * sizeof(int) no longer matches payload_size
+  std::memcpy(buffer.data(), &header, sizeof(header));
+  EXPECT_THROW(s21::deserialize(buffer.data(), buffer.size(), target), std::runtime_error);
+}
+
+//__________________<<SERIALIZE<<_________________
+
+//__________________>>FLAT_SET>>__________________
+
+TEST(FlatSetTest, BulkBuildAndLookup)
+{
+  s21::s21_vector<int> input = {9, 3, 7, 3, 1, 9, 5};
+  s21::flat_set<int> set(input.begin(), input.end());
+  EXPECT_EQ(set.size(), 5U);
+  EXPECT_TRUE(std::is_sorted(set.begin(), set.end()));
+  EXPECT_EQ(*set.lower_bound(4), 5);
+  EXPECT_EQ(*set.upper_bound(5), 7);
+  EXPECT_EQ(set.lower_bound(10), set.end());
+  EXPECT_TRUE(set.contains(7));
+  EXPECT_FALSE(set.contains(4));
+  EXPECT_EQ(set.find(4), set.end());
+
+  auto inserted = set.insert(4);
+  EXPECT_TRUE(inserted.second);
+  EXPECT_EQ(*inserted.first, 4);
+  EXPECT_FALSE(set.insert(4).second);
+  EXPECT_EQ(set.erase(9), 1U);
+  EXPECT_EQ(set.erase(9), 0U);
+  set.erase(set.begin());
+  int expected[] = {3, 4, 5, 7};
+  EXPECT_TRUE(std::equal(set.begin(), set.end(), std::begin(expected), std::end(expected)));
+
+  s21::flat_set<int> other = {8, 3, 2};
+  set.merge(other);
+  EXPECT_TRUE(other.empty());
+  int merged[] = {2, 3, 4, 5, 7, 8};
+  EXPECT_TRUE(std::equal(set.begin(), set.end(), std::begin(merged), std::end(merged)));
+  set.merge(set);
+  EXPECT_TRUE(std::equal(set.begin(), set.end(), std::begin(merged), std::end(merged)));
+  set.insert(input.begin(), input.end());
+  EXPECT_EQ(set.size(), 8U);
+  EXPECT_TRUE(std::is_sorted(set.begin(), set.end()));
+}
+
+TEST(FlatSetTest, MatchesStdSet)
+{
+  s21::flat_set<int, std::greater<int>> flat;
+  std::set<int, std::greater<int>> reference;
+  unsigned seed = 12345;
+  for (int i = 0; i < 2000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>(seed >> 16) % 500;
+    if (i % 4 == 3) {
+      EXPECT_EQ(flat.erase(key), reference.erase(key));
+    } else {
+        EXPECT_EQ(flat.insert(key).second, reference.insert(key).second);
+    }
+  }
+  EXPECT_TRUE(std::equal(flat.begin(), flat.end(), reference.begin(), reference.end()));
+  for (int key = -1; key <= 500; ++key) {
+    EXPECT_EQ(flat.contains(key), reference.count(key) == 1);
+  }
+}
+
+//__________________<<FLAT_SET<<__________________
+
+//__________________>>FLAT_MAP>>__________________
+
+TEST(FlatMapTest, MapInterface)
+{
+  s21::flat_map<int, std::string> map = {{3, "three"}, {1, "one"}, {3, "again"}, {2, "two"}};
+  EXPECT_EQ(map.size(), 3U);
+  EXPECT_EQ(map.at(3), "three");
+  EXPECT_THROW(map.at(4), std::out_of_range);
+  map[4] = "four";
+  EXPECT_EQ(map.at(4), "four");
+  EXPECT_FALSE(map.insert(1, "uno").second);
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_FALSE(map.insert_or_assign(1, "uno").second);
+  EXPECT_EQ(map.at(1), "uno");
+  EXPECT_TRUE(map.insert({0, "zero"}).second);
+
+  int expected = 0;
+  for (auto it = map.begin(); it != map.end(); ++it, ++expected) {
+    EXPECT_EQ((*it).first, expected);
+  }
+  auto it = map.find(2);
+  ASSERT_NE(it, map.end());
+  it->second = "deux";
+  EXPECT_EQ(map.at(2), "deux");
+  EXPECT_EQ(map.keys().size(), map.values().size());
+
+  map.erase(map.find(0));
+  EXPECT_EQ(map.erase(7), 0U);
+  EXPECT_FALSE(map.contains(0));
+
+  s21::flat_map<int, std::string> other = {{5, "five"}, {4, "vier"}};
+  map.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(map.size(), 5U);
+  EXPECT_EQ(map.at(4), "four");
+  EXPECT_EQ(map.at(5), "five");
+  map.merge(map);
+  EXPECT_EQ(map.size(), 5U);
+  EXPECT_EQ(map.at(4), "four");
+
+  const s21::flat_map<int, std::string> copy(map);
+  EXPECT_EQ(copy.find(3)->second, "three");
+  EXPECT_EQ(copy.lower_bound(6), copy.end());
+  EXPECT_EQ(copy.upper_bound(3)->first, 4);
+  EXPECT_EQ(copy.upper_bound(5), copy.end());
+
+  std::vector<std::pair<int, std::string>> more = {{8, "eight"}, {2, "zwei"}, {6, "six"}, {8, "acht"}};
+  map.insert(more.begin(), more.end());
+  EXPECT_EQ(map.size(), 7U);
+  EXPECT_EQ(map.at(2), "deux");
+  EXPECT_EQ(map.at(8), "eight");
+  EXPECT_EQ(map.upper_bound(5)->first, 6);
+}
+
+TEST(FlatMapTest, MatchesStdMap)
+{
+  s21::flat_map<int, int> flat;
+  std::map<int, int> reference;
+  unsigned seed = 777;
+  for (int i = 0; i < 3000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    int key = static_cast<int>(seed >> 16) % 300;
+    if (i % 3 == 2) {
+      EXPECT_EQ(flat.erase(key), reference.erase(key));
+    } else {
+        flat[key] += i;
+        reference[key] += i;
+    }
+  }
+  std::vector<std::pair<int, int>> batch;
+  for (int i = 0; i < 500; ++i) {
+    seed = seed * 1103515245 + 12345;
+    batch.emplace_back(static_cast<int>(seed >> 16) % 600, i);
+  }
+  flat.insert(batch.begin(), batch.end());
+  reference.insert(batch.begin(), batch.end());
+  ASSERT_EQ(flat.size(), reference.size());
+  auto it = flat.begin();
+  for (const auto &pair : reference) {
+    EXPECT_EQ(it->first, pair.first);
+    EXPECT_EQ(it->second, pair.second);
+    ++it;
+  }
+  for (int key = -1; key < 601; key += 7) {
+    auto upper = reference.upper_bound(key);
+    EXPECT_EQ(flat.upper_bound(key) - flat.begin(), std::distance(reference.begin(), upper));
+  }
+}
+
+//__________________<<FLAT_MAP<<__________________
+
+//__________________>>PACKED_INT_VECTOR>>_________
+
+TEST(PackedIntVectorTest, FrameOfReference)
+{
+  s21::s21_vector<uint64_t> values;
+  for (uint64_t i = 0; i < 1000; ++i) {
+    values.push_back(1000000 + (i * 2654435761u) % 200);  // clustered: 8 bits each
+  }
+  values[300] = ~uint64_t(0);  // one block needs all 64 bits
+  for (uint64_t i = 384; i < 512; ++i) {
+    values[i] = 42;  // and one needs none
+  }
+
+  s21::packed_int_vector<> packed;
+  packed.push_back(values[0]);
+  packed.append(values.data() + 1, values.data() + values.size());
+
+  EXPECT_EQ(packed.size(), 1000u);
+  EXPECT_EQ(packed.block_count(), 7u);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(packed[i], values[i]) << i;
+  }
+  EXPECT_EQ(packed.back(), values.back());
+  EXPECT_THROW(packed.at(1000), std::out_of_range);
+
+  s21::s21_vector<uint64_t> decoded = packed.decode();
+  EXPECT_TRUE(std::equal(decoded.begin(), decoded.end(), values.begin(), values.end()));
+  std::size_t seen = 0;
+  packed.for_each_block([&](const uint64_t *block, std::size_t n) {
+    EXPECT_TRUE(std::equal(block, block + n, values.data() + seen));
+    seen += n;
+  });
+  EXPECT_EQ(seen, 1000u);
+
+  s21::packed_int_vector<int32_t> small = {-5, 7, -100, 3};
+  EXPECT_EQ(small[2], -100);
+  EXPECT_EQ(small.size(), 4u);
+}
+
+TEST(PackedIntVectorTest, DeltaForSortedValues)
+{
+  s21::s21_vector<uint64_t> timestamps;
+  uint64_t now = 1700000000000;
+  for (int i = 0; i < 100000; ++i) {
+    now += 1 + (i * 7919) % 13;
+    timestamps.push_back(now);
+  }
+
+  s21::packed_int_vector<uint64_t, s21::packing::delta> packed(timestamps);
+  packed.shrink_to_fit();
+
+  EXPECT_EQ(packed.size(), timestamps.size());
+  EXPECT_LT(packed.memory_bytes(), timestamps.size() * sizeof(uint64_t) / 10);
+  for (std::size_t i = 0; i < timestamps.size(); i += 997) {
+    ASSERT_EQ(packed[i], timestamps[i]) << i;
+  }
+  s21::s21_vector<uint64_t> decoded = packed.decode();
+  EXPECT_TRUE(std::equal(decoded.begin(), decoded.end(), timestamps.begin(), timestamps.end()));
+
+  s21::packed_int_vector<int64_t, s21::packing::delta> unsorted;
+  for (int64_t i = 0; i < 300; ++i) {
+    unsorted.push_back(i % 3 == 0 ? -i * 1000 : i);
+  }
+  for (int64_t i = 0; i < 300; ++i) {
+    ASSERT_EQ(unsorted[i], i % 3 == 0 ? -i * 1000 : i) << i;
+  }
+  s21::s21_vector<int64_t> back = unsorted.decode();
+  EXPECT_EQ(back[297], -297000);
+  unsorted.clear();
+  EXPECT_TRUE(unsorted.empty());
+}
+
+//__________________<<PACKED_INT_VECTOR<<_________
+
+//__________________>>SPAN>>______________________
+
+namespace {
+void double_all(s21::span<int> values)
+{
+  for (int &value : values) {
+    value *= 2;
+  }
+}
+
+long total(s21::span<const int> values)
+{
+  long sum = 0;
+  for (int value : values) {
+    sum += value;
+  }
+  return sum;
+}
+}
+
+TEST(SpanTest, ViewsWithoutCopying)
+{
+  s21::s21_vector<int> v = {1, 2, 3, 4, 5, 6, 7};
+  s21::span<int> all(v);
+  s21::span whole(v);  // deduces span<int>
+  const s21::s21_vector<int> &cv = v;
+  s21::span<const int> read_only = cv;
+
+  EXPECT_EQ(all.data(), v.data());
+  EXPECT_EQ(whole.size(), 7u);
+  EXPECT_EQ(read_only.size_bytes(), 7 * sizeof(int));
+
+  double_all(all.subspan(2, 3));
+  EXPECT_EQ(v[1], 2);
+  EXPECT_EQ(v[2], 6);
+  EXPECT_EQ(v[4], 10);
+  EXPECT_EQ(v[5], 6);
+  EXPECT_EQ(total(all.first(2)), 3);
+  EXPECT_EQ(total(all.last(2)), 13);
+  EXPECT_EQ(total(all), 1 + 2 + 6 + 8 + 10 + 6 + 7);
+  EXPECT_EQ(all.subspan(5).front(), 6);
+  EXPECT_EQ(*all.rbegin(), 7);
+  EXPECT_EQ(all.end() - all.begin(), 7);
+  EXPECT_THROW(all.subspan(8), std::out_of_range);
+  EXPECT_THROW(all.subspan(3, 5), std::out_of_range);
+  EXPECT_THROW(all.first(8), std::out_of_range);
+  EXPECT_THROW(all.at(7), std::out_of_range);
+
+  int raw[] = {5, 6};
+  EXPECT_EQ(total(raw), 11);
+  EXPECT_EQ(total(s21::span<const int>(raw, raw + 1)), 5);
+  EXPECT_TRUE(s21::span<int>(raw, 0).empty());
+
+  s21::s21_small_vector<double, 4> small = {1.5, 2.5};
+  s21::soa_vector<int, double> rows;
+  rows.push_back({1, 0.5});
+  rows.push_back({2, 1.5});
+  s21::span<double> prices = s21::column_span<1>(rows);
+  prices[0] = 9.5;
+  EXPECT_EQ(std::get<1>(rows[0]), 9.5);
+  EXPECT_EQ(s21::span<const double>(small).back(), 2.5);
+  EXPECT_FALSE((std::is_constructible<s21::span<uint64_t>, s21::s21_vector<bool> &>::value));
+  EXPECT_FALSE((std::is_constructible<s21::span<int>, const s21::s21_vector<int> &>::value));
+}
+
+TEST(SpanTest, ChunksFanOutToThreads)
+{
+  s21::s21_vector<int> v(1000, 1);
+  s21::span<int> all(v);
+  auto pieces = all.chunks(300);
+  EXPECT_EQ(pieces.size(), 4u);
+  EXPECT_EQ(pieces[3].size(), 100u);
+  EXPECT_THROW(all.chunks(0), std::invalid_argument);
+  EXPECT_EQ(s21::span<int>().chunks(8).size(), 0u);
+
+  std::vector<std::thread> workers;
+  std::size_t covered = 0;
+  for (s21::span<int> piece : pieces) {
+    covered += piece.size();
+    workers.emplace_back([piece] { double_all(piece); });
+  }
+  for (std::thread &worker : workers) {
+    worker.join();
+  }
+  EXPECT_EQ(covered, 1000u);
+  EXPECT_EQ(total(v), 2000);
+}
+
+//__________________<<SPAN<<______________________
 
 //__________________>>SET>>_______________________
 
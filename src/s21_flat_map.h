@@ -0,0 +1,354 @@
+#ifndef SRC_S21_FLAT_MAP_H_
+#define SRC_S21_FLAT_MAP_H_
+
+#include "s21_flat_set.h"
+
+namespace s21 {
+
+  // Map kept as two parallel s21_vectors, the sorted keys and the values in the
+  // same order. A lookup is a binary search over the keys only, which stay
+  // dense in cache however large the values are; the value is then fetched
+  // from the same index. Like flat_set it is meant to be built in bulk and
+  // then read: the range constructor sorts once, single inserts and erases
+  // shift both arrays. Iterators yield pair<const Key &, T &> proxies.
+  template <typename Key, typename T, typename Compare = std::less<Key>>
+  class flat_map
+  {
+    static_assert(!std::is_same<Key, bool>::value && !std::is_same<T, bool>::value, "flat_map: s21_vector<bool> has no element references");
+
+    template <bool Const>
+    class flat_map_iterator;
+
+  public:
+    using key_type = Key;
+    using mapped_type = T;
+    using value_type = std::pair<Key, T>;
+    using key_compare = Compare;
+    using reference = std::pair<const Key &, T &>;
+    using const_reference = std::pair<const Key &, const T &>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = flat_map_iterator<false>;
+    using const_iterator = flat_map_iterator<true>;
+    using key_container_type = s21_vector<Key>;
+    using mapped_container_type = s21_vector<T>;
+
+    flat_map() = default; // default constructor, creates empty map
+
+    flat_map(std::initializer_list<value_type> const &items) : flat_map(items.begin(), items.end()) {} // initializer list constructor
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    flat_map(InputIt first, InputIt last) // builds the map from unsorted pairs, the first of equal keys wins
+    {
+      s21_vector<value_type> items(first, last);
+      std::stable_sort(items.begin(), items.end(), [this](const value_type &a, const value_type &b) { return comp_(a.first, b.first); });
+      keys_.reserve(items.size());
+      values_.reserve(items.size());
+      for (size_type i = 0; i < items.size(); ++i) {
+        if (i == 0 || comp_(keys_.back(), items[i].first)) {
+          keys_.push_back(std::move(items[i].first));
+          values_.push_back(std::move(items[i].second));
+        }
+      }
+    }
+
+    flat_map(const flat_map &m) = default; // copy constructor
+
+    flat_map(flat_map &&m) noexcept // move constructor, leaves m empty
+    {
+      swap(m);
+    }
+
+    flat_map &operator=(const flat_map &m) = default;
+
+    flat_map &operator=(flat_map &&m) noexcept // assignment operator overload for moving object
+    {
+      if (this != &m) {
+        flat_map tmp(std::move(m));
+        swap(tmp);
+      }
+      return *this;
+    }
+
+    ~flat_map() = default;
+
+// Capacity =====================================================================================
+    bool empty() const noexcept { return keys_.empty(); }
+
+    size_type size() const noexcept { return keys_.size(); }
+
+    size_type max_size() const noexcept { return std::min(keys_.max_size(), values_.max_size()); }
+
+    void reserve(size_type n)
+    {
+      keys_.reserve(n);
+      values_.reserve(n);
+    }
+
+    void shrink_to_fit()
+    {
+      keys_.shrink_to_fit();
+      values_.shrink_to_fit();
+    }
+
+// Element access =============================================================================
+    mapped_type &at(const Key &key)  // access the value of key with bounds checking
+    {
+      size_type index = position(key);
+      if (index == size() || comp_(key, keys_[index])) {
+        throw std::out_of_range("flat_map::at");
+      }
+      return values_[index];
+    }
+
+    const mapped_type &at(const Key &key) const
+    {
+      size_type index = position(key);
+      if (index == size() || comp_(key, keys_[index])) {
+        throw std::out_of_range("flat_map::at");
+      }
+      return values_[index];
+    }
+
+    mapped_type &operator[](const Key &key)  // access the value of key, inserting a value-initialized one if it is missing
+    {
+      size_type index = position(key);
+      if (index == size() || comp_(key, keys_[index])) {
+        emplace_at(index, key, mapped_type());
+      }
+      return values_[index];
+    }
+
+// Modifiers ====================================================================================
+    void clear() noexcept
+    {
+      keys_.clear();
+      values_.clear();
+    }
+
+    std::pair<iterator, bool> insert(const value_type &value)  // inserts value unless its key is there
+    {
+      return insert(value.first, value.second);
+    }
+
+    std::pair<iterator, bool> insert(const Key &key, const T &obj)
+    {
+      size_type index = position(key);
+      if (index != size() && !comp_(key, keys_[index])) {
+        return {begin() + static_cast<difference_type>(index), false};
+      }
+      emplace_at(index, key, obj);
+      return {begin() + static_cast<difference_type>(index), true};
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void insert(InputIt first, InputIt last)  // inserts the pairs whose keys are missing: sorts the range, then merges once
+    {
+      flat_map incoming(first, last);
+      merge(incoming);
+    }
+
+    std::pair<iterator, bool> insert_or_assign(const Key &key, const T &obj)  // inserts, or assigns obj to the present value
+    {
+      size_type index = position(key);
+      if (index != size() && !comp_(key, keys_[index])) {
+        values_[index] = obj;
+        return {begin() + static_cast<difference_type>(index), false};
+      }
+      emplace_at(index, key, obj);
+      return {begin() + static_cast<difference_type>(index), true};
+    }
+
+    void erase(const_iterator pos)  // erases the pair at pos
+    {
+      keys_.erase(keys_.cbegin() + pos.index_);
+      values_.erase(values_.cbegin() + pos.index_);
+    }
+
+    size_type erase(const Key &key)  // erases key, returns how many pairs were erased
+    {
+      const_iterator pos = find(key);
+      if (pos == cend()) {
+        return 0;
+      }
+      erase(pos);
+      return 1;
+    }
+
+    void swap(flat_map &other) noexcept
+    {
+      keys_.swap(other.keys_);
+      values_.swap(other.values_);
+      std::swap(comp_, other.comp_);
+    }
+
+    void merge(flat_map &other)  // takes the pairs of other whose keys are missing here, other is left empty like Map::merge
+    {
+      if (this == &other) {
+        return;
+      }
+      key_container_type keys;
+      mapped_container_type values;
+      keys.reserve(keys_.size() + other.keys_.size());
+      values.reserve(keys_.size() + other.keys_.size());
+      size_type i = 0, j = 0;
+      while (i < keys_.size() && j < other.keys_.size()) {
+        if (comp_(other.keys_[j], keys_[i])) {
+          keys.push_back(std::move(other.keys_[j]));
+          values.push_back(std::move(other.values_[j++]));
+        } else {
+            if (!comp_(keys_[i], other.keys_[j])) {
+              ++j;
+            }
+            keys.push_back(std::move(keys_[i]));
+            values.push_back(std::move(values_[i++]));
+        }
+      }
+      for (; i < keys_.size(); ++i) {
+        keys.push_back(std::move(keys_[i]));
+        values.push_back(std::move(values_[i]));
+      }
+      for (; j < other.keys_.size(); ++j) {
+        keys.push_back(std::move(other.keys_[j]));
+        values.push_back(std::move(other.values_[j]));
+      }
+      keys_.swap(keys);
+      values_.swap(values);
+      other.clear();
+    }
+
+// Lookup =======================================================================================
+    iterator find(const Key &key)
+    {
+      size_type index = position(key);
+      return index != size() && !comp_(key, keys_[index]) ? begin() + static_cast<difference_type>(index) : end();
+    }
+
+    const_iterator find(const Key &key) const
+    {
+      size_type index = position(key);
+      return index != size() && !comp_(key, keys_[index]) ? begin() + static_cast<difference_type>(index) : end();
+    }
+
+    bool contains(const Key &key) const
+    {
+      size_type index = position(key);
+      return index != size() && !comp_(key, keys_[index]);
+    }
+
+    size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+    iterator lower_bound(const Key &key) { return begin() + static_cast<difference_type>(position(key)); }  // first pair whose key is not less than key
+
+    const_iterator lower_bound(const Key &key) const { return begin() + static_cast<difference_type>(position(key)); }
+
+    iterator upper_bound(const Key &key) { return begin() + static_cast<difference_type>(upper_position(key)); }  // first pair whose key is greater than key
+
+    const_iterator upper_bound(const Key &key) const { return begin() + static_cast<difference_type>(upper_position(key)); }
+
+    const key_container_type &keys() const noexcept { return keys_; }  // the sorted keys
+
+    const mapped_container_type &values() const noexcept { return values_; }  // the values, in key order
+
+// Iterators ====================================================================================
+    iterator begin() noexcept { return iterator(keys_.data(), values_.data(), 0); }
+    iterator end() noexcept { return begin() + static_cast<difference_type>(size()); }
+
+    const_iterator begin() const noexcept { return const_iterator(keys_.data(), values_.data(), 0); }
+    const_iterator end() const noexcept { return begin() + static_cast<difference_type>(size()); }
+
+    const_iterator cbegin() const noexcept { return begin(); }
+    const_iterator cend() const noexcept { return end(); }
+
+  private:
+    template <bool Const>
+    class flat_map_iterator {  // random access over pairs; dereferencing yields a pair of references into both arrays
+      friend class flat_map;
+      friend class flat_map_iterator<!Const>;
+
+      using mapped_pointer = std::conditional_t<Const, const T *, T *>;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::pair<Key, T>;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, std::pair<const Key &, const T &>, std::pair<const Key &, T &>>;
+
+        struct pointer {  // what operator-> returns: the pair proxy held by value
+          reference pair;
+          const reference *operator->() const { return &pair; }
+        };
+
+        flat_map_iterator() : keys_(nullptr), values_(nullptr), index_(0) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        flat_map_iterator(const flat_map_iterator<false> &other) : keys_(other.keys_), values_(other.values_), index_(other.index_) {}
+
+        reference operator*() const { return reference(keys_[index_], values_[index_]); }
+        pointer operator->() const { return pointer{**this}; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        flat_map_iterator &operator++() { ++index_; return *this; }
+        flat_map_iterator operator++(int) { flat_map_iterator tmp(*this); ++index_; return tmp; }
+        flat_map_iterator &operator--() { --index_; return *this; }
+        flat_map_iterator operator--(int) { flat_map_iterator tmp(*this); --index_; return tmp; }
+        flat_map_iterator &operator+=(difference_type n) { index_ += n; return *this; }
+        flat_map_iterator &operator-=(difference_type n) { index_ -= n; return *this; }
+
+        friend flat_map_iterator operator+(flat_map_iterator it, difference_type n) { return it += n; }
+        friend flat_map_iterator operator+(difference_type n, flat_map_iterator it) { return it += n; }
+        friend flat_map_iterator operator-(flat_map_iterator it, difference_type n) { return it -= n; }
+
+        template <bool C>
+        difference_type operator-(const flat_map_iterator<C> &other) const { return index_ - other.index_; }
+        template <bool C>
+        bool operator==(const flat_map_iterator<C> &other) const { return index_ == other.index_; }
+        template <bool C>
+        bool operator!=(const flat_map_iterator<C> &other) const { return index_ != other.index_; }
+        template <bool C>
+        bool operator<(const flat_map_iterator<C> &other) const { return index_ < other.index_; }
+        template <bool C>
+        bool operator>(const flat_map_iterator<C> &other) const { return index_ > other.index_; }
+        template <bool C>
+        bool operator<=(const flat_map_iterator<C> &other) const { return index_ <= other.index_; }
+        template <bool C>
+        bool operator>=(const flat_map_iterator<C> &other) const { return index_ >= other.index_; }
+
+      private:
+        flat_map_iterator(const Key *keys, mapped_pointer values, difference_type index) : keys_(keys), values_(values), index_(index) {}
+
+        const Key *keys_;
+        mapped_pointer values_;
+        difference_type index_;
+    };
+
+    size_type position(const Key &key) const  // index of the first key not less than key
+    {
+      return static_cast<size_type>(detail::flat_lower_bound(keys_.data(), keys_.size(), key, comp_) - keys_.data());
+    }
+
+    size_type upper_position(const Key &key) const  // index of the first key greater than key
+    {
+      size_type index = position(key);
+      return index != size() && !comp_(key, keys_[index]) ? index + 1 : index;
+    }
+
+    void emplace_at(size_type index, const Key &key, const T &obj)  // both arrays get the new pair or neither does
+    {
+      keys_.insert(keys_.cbegin() + static_cast<difference_type>(index), key);
+      try {
+        values_.insert(values_.cbegin() + static_cast<difference_type>(index), obj);
+      } catch (...) {
+          keys_.erase(keys_.cbegin() + static_cast<difference_type>(index));
+          throw;
+      }
+    }
+
+    key_container_type keys_;
+    mapped_container_type values_;
+    Compare comp_ = Compare();
+  };
+
+}
+
+#endif  // SRC_S21_FLAT_MAP_H_
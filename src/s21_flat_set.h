@@ -0,0 +1,223 @@
+#ifndef SRC_S21_FLAT_SET_H_
+#define SRC_S21_FLAT_SET_H_
+
+#include <algorithm>
+#include <functional>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  namespace detail {
+
+    // Binary search without a data dependent branch: the loop always runs
+    // log2(n) times and the step is a conditional move, so lookups of random
+    // keys do not pay a branch mispredict per level. Returns the first element
+    // of [first, first + n) that is not less than key.
+    template <typename T, typename Key, typename Compare>
+    const T *flat_lower_bound(const T *first, std::size_t n, const Key &key, Compare comp)
+    {
+      if (n == 0) {
+        return first;
+      }
+      while (n > 1) {
+        std::size_t half = n / 2;
+        first = comp(first[half], key) ? first + half : first;
+        n -= half;
+      }
+      return first + (comp(*first, key) ? 1 : 0);
+    }
+
+    // drops all but the first of each run of equal keys in a sorted vector
+    template <typename Key, typename Compare>
+    void drop_duplicates(s21_vector<Key> &keys, Compare comp)
+    {
+      auto last = std::unique(keys.begin(), keys.end(), [&comp](const Key &a, const Key &b) { return !comp(a, b); });
+      while (keys.end() != last) {
+        keys.pop_back();
+      }
+    }
+
+    // sorts keys, keeping the first of equal keys
+    template <typename Key, typename Compare>
+    void sort_unique(s21_vector<Key> &keys, Compare comp)
+    {
+      std::stable_sort(keys.begin(), keys.end(), comp);
+      drop_duplicates(keys, comp);
+    }
+
+  }  // namespace detail
+
+  // Set kept as a sorted s21_vector: lookups are a binary search over one dense
+  // array instead of a pointer chase through tree nodes, and iteration is a
+  // linear scan. Inserting or erasing a single key shifts the keys after it, so
+  // this is for sets that are built in bulk (the range constructor sorts and
+  // drops duplicates once) and then mostly read. Keys are immutable, as in Set.
+  template <typename Key, typename Compare = std::less<Key>>
+  class flat_set
+  {
+    static_assert(!std::is_same<Key, bool>::value, "flat_set: s21_vector<bool> has no data() to search");
+
+  public:
+    using key_type = Key;
+    using value_type = Key;
+    using key_compare = Compare;
+    using reference = value_type &;
+    using const_reference = const value_type &;
+    using size_type = std::size_t;
+    using container_type = s21_vector<Key>;
+    using iterator = typename container_type::const_iterator;
+    using const_iterator = typename container_type::const_iterator;
+
+    flat_set() = default; // default constructor, creates empty set
+
+    flat_set(std::initializer_list<value_type> const &items) : flat_set(items.begin(), items.end()) {} // initializer list constructor
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    flat_set(InputIt first, InputIt last) : keys_(first, last) // builds the set from unsorted keys, duplicates are dropped
+    {
+      detail::sort_unique(keys_, comp_);
+    }
+
+    explicit flat_set(container_type keys) : keys_(std::move(keys)) // adopts an unsorted vector of keys
+    {
+      detail::sort_unique(keys_, comp_);
+    }
+
+    flat_set(const flat_set &s) = default; // copy constructor
+
+    flat_set(flat_set &&s) noexcept // move constructor, leaves s empty
+    {
+      swap(s);
+    }
+
+    flat_set &operator=(const flat_set &s) = default;
+
+    flat_set &operator=(flat_set &&s) noexcept // assignment operator overload for moving object
+    {
+      if (this != &s) {
+        flat_set tmp(std::move(s));
+        swap(tmp);
+      }
+      return *this;
+    }
+
+    ~flat_set() = default;
+
+// Capacity =====================================================================================
+    bool empty() const noexcept { return keys_.empty(); }
+
+    size_type size() const noexcept { return keys_.size(); }
+
+    size_type max_size() const noexcept { return keys_.max_size(); }
+
+    void reserve(size_type n) { keys_.reserve(n); }
+
+    void shrink_to_fit() { keys_.shrink_to_fit(); }
+
+// Modifiers ====================================================================================
+    void clear() noexcept { keys_.clear(); }
+
+    std::pair<iterator, bool> insert(const value_type &value)  // inserts value unless an equal key is there
+    {
+      iterator pos = lower_bound(value);
+      if (pos != end() && !comp_(value, *pos)) {
+        return {pos, false};
+      }
+      return {keys_.insert(pos, value), true};
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    void insert(InputIt first, InputIt last)  // appends the range, then sorts and merges once
+    {
+      size_type old_size = keys_.size();
+      keys_.insert(keys_.cend(), first, last);
+      std::stable_sort(keys_.begin() + old_size, keys_.end(), comp_);
+      std::inplace_merge(keys_.begin(), keys_.begin() + old_size, keys_.end(), comp_);
+      detail::drop_duplicates(keys_, comp_);
+    }
+
+    void erase(iterator pos) { keys_.erase(pos); }  // erases the key at pos
+
+    size_type erase(const Key &key)  // erases key, returns how many keys were erased
+    {
+      iterator pos = find(key);
+      if (pos == end()) {
+        return 0;
+      }
+      keys_.erase(pos);
+      return 1;
+    }
+
+    void swap(flat_set &other) noexcept
+    {
+      keys_.swap(other.keys_);
+      std::swap(comp_, other.comp_);
+    }
+
+    void merge(flat_set &other)  // takes the keys of other that are missing here, other is left empty like Set::merge
+    {
+      if (this == &other) {
+        return;
+      }
+      container_type merged;
+      merged.reserve(keys_.size() + other.keys_.size());
+      size_type i = 0, j = 0;
+      while (i < keys_.size() && j < other.keys_.size()) {
+        if (comp_(other.keys_[j], keys_[i])) {
+          merged.push_back(std::move(other.keys_[j++]));
+        } else {
+            if (!comp_(keys_[i], other.keys_[j])) {
+              ++j;
+            }
+            merged.push_back(std::move(keys_[i++]));
+        }
+      }
+      for (; i < keys_.size(); ++i) {
+        merged.push_back(std::move(keys_[i]));
+      }
+      for (; j < other.keys_.size(); ++j) {
+        merged.push_back(std::move(other.keys_[j]));
+      }
+      keys_.swap(merged);
+      other.keys_.clear();
+    }
+
+// Lookup =======================================================================================
+    iterator find(const Key &key) const
+    {
+      iterator pos = lower_bound(key);
+      return pos != end() && !comp_(key, *pos) ? pos : end();
+    }
+
+    bool contains(const Key &key) const { return find(key) != end(); }
+
+    size_type count(const Key &key) const { return contains(key) ? 1 : 0; }
+
+    iterator lower_bound(const Key &key) const  // first key not less than key
+    {
+      return begin() + (detail::flat_lower_bound(keys_.data(), keys_.size(), key, comp_) - keys_.data());
+    }
+
+    iterator upper_bound(const Key &key) const  // first key greater than key
+    {
+      iterator pos = lower_bound(key);
+      return pos != end() && !comp_(key, *pos) ? pos + 1 : pos;
+    }
+
+// Iterators ====================================================================================
+    iterator begin() const noexcept { return keys_.cbegin(); }
+    iterator end() const noexcept { return keys_.cend(); }
+
+    const value_type *data() const noexcept { return keys_.data(); }  // the sorted keys
+
+    const container_type &keys() const noexcept { return keys_; }
+
+  private:
+    container_type keys_;
+    Compare comp_ = Compare();
+  };
+
+}
+
+#endif  // SRC_S21_FLAT_SET_H_
@@ -0,0 +1,585 @@
+#ifndef SRC_S21_GAP_VECTOR_H_
+#define SRC_S21_GAP_VECTOR_H_
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // Sequence with the s21_vector interface whose spare capacity is kept as a gap
+  // in the middle of the buffer instead of at the end: [0, gap_begin) holds the
+  // elements before the gap, [gap_end, capacity) the ones after it. Inserting or
+  // erasing at the gap is O(1) amortized, as push_back is for s21_vector; an
+  // edit anywhere else first moves the gap there, relocating only the elements
+  // between the old and the new position. Edits that stay near a cursor, as in
+  // a text editor, never shift the rest of the buffer. Element access costs a
+  // compare to find the side of the gap, and iterators are not contiguous.
+  // Relocation follows s21_vector: bytewise for trivially relocatable types.
+  template <typename T, typename Allocator = std::allocator<T>, typename GrowthPolicy = growth::doubling<>>
+  class gap_vector
+  {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static_assert(!std::is_same<T, bool>::value, "gap_vector: no bit-packed variant, store char");
+
+    template <bool Const>
+    class gap_iterator;
+
+  public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using growth_policy = GrowthPolicy;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = typename alloc_traits::size_type;
+    using difference_type = typename alloc_traits::difference_type;
+    using iterator = gap_iterator<false>;
+    using const_iterator = gap_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    gap_vector() noexcept(noexcept(Allocator())) : gap_vector(Allocator()) {} // default constructor, creates empty vector
+
+    explicit gap_vector(const Allocator &alloc) noexcept // creates empty vector which will allocate from alloc
+        : alloc_(alloc), array_(nullptr), gap_begin_(0), gap_end_(0), capacity_array_(0) {}
+
+    gap_vector(size_type n, const_reference value = T(), const Allocator &alloc = Allocator()) : gap_vector(alloc)  // creates n copies of value
+    {
+      insert(cend(), n, value);
+    }
+
+    gap_vector(std::initializer_list<value_type> const &items, const Allocator &alloc = Allocator()) // initializer list constructor
+        : gap_vector(alloc)
+    {
+      insert(cend(), items.begin(), items.end());
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    gap_vector(InputIt first, InputIt last, const Allocator &alloc = Allocator()) : gap_vector(alloc) // range constructor, copies [first, last)
+    {
+      insert(cend(), first, last);
+    }
+
+    gap_vector(const gap_vector &v) // copy constructor, the copy has its gap at the end
+        : gap_vector(alloc_traits::select_on_container_copy_construction(v.alloc_))
+    {
+      insert(cend(), v.begin(), v.end());
+    }
+
+    gap_vector(gap_vector &&v) noexcept // move constructor, takes the buffer and the gap of v
+        : gap_vector(v.alloc_)
+    {
+      steal(v);
+    }
+
+    gap_vector &operator=(const gap_vector &v) // copy assignment
+    {
+      if (this != &v) {
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          if (alloc_ != v.alloc_) {
+            release();  // the buffer belongs to the allocator being replaced
+          }
+          alloc_ = v.alloc_;
+        }
+        clear();
+        insert(cend(), v.begin(), v.end());
+      }
+      return *this;
+    }
+
+    gap_vector &operator=(gap_vector &&v) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) // assignment operator overload for moving object
+    {
+      if (this != &v) {
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          release();
+          alloc_ = v.alloc_;
+          steal(v);
+        } else {
+            if (alloc_traits::is_always_equal::value || alloc_ == v.alloc_) {
+              release();
+              steal(v);
+            } else {  // v's buffer can't be freed through our allocator: move the elements over one by one
+                clear();
+                insert(cend(), std::make_move_iterator(v.begin()), std::make_move_iterator(v.end()));
+            }
+        }
+      }
+      return *this;
+    }
+
+    ~gap_vector() noexcept // destructor
+    {
+      clear();
+      deallocate(array_, capacity_array_);
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+      return alloc_;
+    }
+
+// Capacity =====================================================================================
+    bool empty() const noexcept // checks whether the container is empty
+    {
+      return size() ? false : true;
+    }
+
+    size_type size() const noexcept  // returns the number of elements
+    {
+      return capacity_array_ - gap_size();
+    }
+
+    size_type max_size() const noexcept // returns the maximum possible number of elements
+    {
+      size_type by_size = static_cast<size_type>(static_cast<size_type>(-1) / sizeof(value_type) / 2);
+      size_type by_alloc = alloc_traits::max_size(alloc_);
+      return by_size < by_alloc ? by_size : by_alloc;
+    }
+
+    void reserve(size_type new_capacity)  // grows the gap so that new_capacity elements fit, the gap stays where it is
+    {
+      if (new_capacity > max_size()) {
+        throw std::length_error("gap_vector::reserve: capacity exceeds max_size()");
+      }
+      if (new_capacity > capacity_array_) {
+        reallocate(new_capacity);
+      }
+    }
+
+    void resize(size_type new_size, const_reference value = T())
+    {
+      size_type old_size = size();
+      if (new_size > old_size) {
+        insert(cend(), new_size - old_size, value);
+      } else {
+          erase(cbegin() + static_cast<difference_type>(new_size), cend());
+      }
+    }
+
+    size_type capacity() const noexcept // returns the number of elements that can be held in currently allocated storage
+    {
+      return capacity_array_;
+    }
+
+    void shrink_to_fit()  // reallocates to exactly size() elements, closing the gap
+    {
+      if (gap_size()) {
+        reallocate(size());
+      }
+    }
+
+    size_type gap_position() const noexcept  // index the next insertion is cheap at
+    {
+      return gap_begin_;
+    }
+
+    size_type gap_size() const noexcept  // free slots in the gap
+    {
+      return gap_end_ - gap_begin_;
+    }
+
+// Modifiers ====================================================================================
+    void move_gap(size_type pos)  // moves the gap in front of element pos, relocating the elements in between
+    {
+      if (pos > size()) {
+        throw std::out_of_range("gap_vector::move_gap: position out of range");
+      }
+      size_type gap = gap_size();
+      if (gap == 0) {  // a closed gap moves for free
+        gap_begin_ = gap_end_ = pos;
+      } else if (pos < gap_begin_) {
+        try {
+          detail::relocate_right(alloc_, array_ + pos, array_ + gap_begin_, gap);
+        } catch (...) {
+            gap_begin_ = pos;  // [pos, gap_end) is raw now: the elements in it are lost
+            throw;
+        }
+        gap_end_ = pos + gap;
+        gap_begin_ = pos;
+      } else if (pos > gap_begin_) {
+          size_type shift = pos - gap_begin_;
+          try {
+            detail::relocate_left(alloc_, array_ + gap_end_, array_ + gap_end_ + shift, gap);
+          } catch (...) {
+              gap_end_ += shift;  // [gap_begin, gap_end + shift) is raw now: the elements in it are lost
+              throw;
+          }
+          gap_begin_ = pos;
+          gap_end_ += shift;
+      }
+    }
+
+    void clear() noexcept  // clears the contents, keeps the storage
+    {
+      detail::destroy(alloc_, array_, array_ + gap_begin_);
+      detail::destroy(alloc_, array_ + gap_end_, array_ + capacity_array_);
+      gap_begin_ = 0;
+      gap_end_ = capacity_array_;
+    }
+
+    iterator insert(const_iterator pos, const_reference value)  // inserts value before pos and returns the iterator that points to it
+    {
+      return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, value_type &&value)  // inserts value by moving it before pos
+    {
+      return emplace(pos, std::move(value));
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)  // constructs an element in place before pos and returns the iterator to it
+    {
+      size_type index = static_cast<size_type>(pos.index_);
+      if (index != gap_begin_ || !gap_size()) {
+        value_type tmp(std::forward<Args>(args)...);  // args may refer to elements the gap is about to move
+        open_gap(index, 1);
+        alloc_traits::construct(alloc_, array_ + gap_begin_, std::move(tmp));
+      } else {
+          alloc_traits::construct(alloc_, array_ + gap_begin_, std::forward<Args>(args)...);
+      }
+      ++gap_begin_;
+      return iterator(this, static_cast<difference_type>(index));
+    }
+
+    iterator insert(const_iterator pos, size_type n, const_reference value)  // inserts n copies of value before pos
+    {
+      size_type index = static_cast<size_type>(pos.index_);
+      if (n) {
+        value_type tmp(value);  // value may refer to an element the gap is about to move
+        open_gap(index, n);
+        detail::uninitialized_fill_n(alloc_, array_ + gap_begin_, n, tmp);
+        gap_begin_ += n;
+      }
+      return iterator(this, static_cast<difference_type>(index));
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)  // inserts [first, last) before pos, growing at most once for forward ranges
+    {
+      size_type index = static_cast<size_type>(pos.index_);
+      if constexpr (detail::is_forward_iterator<InputIt>::value) {
+        size_type n = static_cast<size_type>(std::distance(first, last));
+        if (n) {
+          open_gap(index, n);
+          detail::uninitialized_copy(alloc_, first, last, array_ + gap_begin_);
+          gap_begin_ += n;
+        }
+      } else {
+          for (size_type at = index; first != last; ++first, ++at) {  // each one lands at the gap
+            emplace(cbegin() + static_cast<difference_type>(at), *first);
+          }
+      }
+      return iterator(this, static_cast<difference_type>(index));
+    }
+
+    iterator erase(const_iterator pos)  // erases element at pos, the gap takes its place
+    {
+      return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)  // erases [first, last), the gap takes its place
+    {
+      size_type from = static_cast<size_type>(first.index_);
+      size_type to = static_cast<size_type>(last.index_);
+      if (from > to || to > size()) {
+        throw std::out_of_range("Invalid pointer");
+      }
+      if (from != to) {
+        if (to == gap_begin_) {  // backspace: the range ends at the gap
+          detail::destroy(alloc_, array_ + from, array_ + to);
+          gap_begin_ = from;
+        } else {
+            move_gap(from);
+            detail::destroy(alloc_, array_ + gap_end_, array_ + gap_end_ + (to - from));
+            gap_end_ += to - from;
+        }
+      }
+      return iterator(this, static_cast<difference_type>(from));
+    }
+
+    void push_back(const_reference value)
+    {
+      emplace(cend(), value);
+    }
+
+    void push_back(value_type &&value)  // appends value by moving it
+    {
+      emplace(cend(), std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)  // constructs an element in place at the end
+    {
+      return *emplace(cend(), std::forward<Args>(args)...);
+    }
+
+    void pop_back()  // removes the last element
+    {
+      erase(cend() - 1);
+    }
+
+    void swap(gap_vector &other) noexcept(
+        alloc_traits::propagate_on_container_swap::value || alloc_traits::is_always_equal::value) // swaps the buffers; with unequal allocators that don't propagate the elements are moved
+    {
+      if (alloc_traits::propagate_on_container_swap::value || alloc_traits::is_always_equal::value || alloc_ == other.alloc_) {
+        std::swap(array_, other.array_);
+        std::swap(gap_begin_, other.gap_begin_);
+        std::swap(gap_end_, other.gap_end_);
+        std::swap(capacity_array_, other.capacity_array_);
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+          std::swap(alloc_, other.alloc_);
+        }
+      } else {
+          gap_vector tmp(std::move(other));
+          other = std::move(*this);
+          *this = std::move(tmp);
+      }
+    }
+
+// Element access =============================================================================
+    reference at(size_type j) // access specified element with bounds checking
+    {
+      if (j >= size()) {
+        throw std::out_of_range("gap_vector::at: index out of range");
+      }
+      return (*this)[j];
+    }
+
+    const_reference at(size_type j) const
+    {
+      if (j >= size()) {
+        throw std::out_of_range("gap_vector::at: index out of range");
+      }
+      return (*this)[j];
+    }
+
+    reference operator[](size_type j) noexcept // access specified element, skipping the gap
+    {
+      return array_[j < gap_begin_ ? j : j + gap_size()];
+    }
+
+    const_reference operator[](size_type j) const noexcept // access specified element, skipping the gap
+    {
+      return array_[j < gap_begin_ ? j : j + gap_size()];
+    }
+
+    reference front() noexcept // access the first element
+    {
+      return (*this)[0];
+    }
+
+    const_reference front() const noexcept // access the first element
+    {
+      return (*this)[0];
+    }
+
+    reference back() noexcept // access the last element
+    {
+      return (*this)[size() - 1];
+    }
+
+    const_reference back() const noexcept // access the last element
+    {
+      return (*this)[size() - 1];
+    }
+
+// Iterators ====================================================================================
+    iterator begin() noexcept  // returns an iterator to the beginning
+    {
+      return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept
+    {
+      return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept  // returns an iterator to the end
+    {
+      return iterator(this, static_cast<difference_type>(size()));
+    }
+
+    const_iterator end() const noexcept
+    {
+      return const_iterator(this, static_cast<difference_type>(size()));
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+    reverse_iterator rbegin() noexcept  // returns a reverse iterator to the last element
+    {
+      return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+      return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept  // returns a reverse iterator past the first element
+    {
+      return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+      return const_reverse_iterator(begin());
+    }
+
+  private:
+    template <bool Const>
+    class gap_iterator {  // random access by index; dereferencing skips the gap
+      friend class gap_vector;
+      friend class gap_iterator<!Const>;
+
+      using container_pointer = std::conditional_t<Const, const gap_vector *, gap_vector *>;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        gap_iterator() : container_(nullptr), index_(0) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        gap_iterator(const gap_iterator<false> &other) : container_(other.container_), index_(other.index_) {}
+
+        reference operator*() const { return (*container_)[static_cast<size_type>(index_)]; }
+        pointer operator->() const { return &**this; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        gap_iterator &operator++() { ++index_; return *this; }
+        gap_iterator operator++(int) { gap_iterator tmp(*this); ++index_; return tmp; }
+        gap_iterator &operator--() { --index_; return *this; }
+        gap_iterator operator--(int) { gap_iterator tmp(*this); --index_; return tmp; }
+        gap_iterator &operator+=(difference_type n) { index_ += n; return *this; }
+        gap_iterator &operator-=(difference_type n) { index_ -= n; return *this; }
+
+        friend gap_iterator operator+(gap_iterator it, difference_type n) { return it += n; }
+        friend gap_iterator operator+(difference_type n, gap_iterator it) { return it += n; }
+        friend gap_iterator operator-(gap_iterator it, difference_type n) { return it -= n; }
+
+        template <bool C>
+        difference_type operator-(const gap_iterator<C> &other) const { return index_ - other.index_; }
+        template <bool C>
+        bool operator==(const gap_iterator<C> &other) const { return index_ == other.index_; }
+        template <bool C>
+        bool operator!=(const gap_iterator<C> &other) const { return index_ != other.index_; }
+        template <bool C>
+        bool operator<(const gap_iterator<C> &other) const { return index_ < other.index_; }
+        template <bool C>
+        bool operator>(const gap_iterator<C> &other) const { return index_ > other.index_; }
+        template <bool C>
+        bool operator<=(const gap_iterator<C> &other) const { return index_ <= other.index_; }
+        template <bool C>
+        bool operator>=(const gap_iterator<C> &other) const { return index_ >= other.index_; }
+
+      private:
+        gap_iterator(container_pointer container, difference_type index) : container_(container), index_(index) {}
+
+        container_pointer container_;
+        difference_type index_;
+    };
+
+    value_type *allocate(size_type n)
+    {
+      return n ? alloc_traits::allocate(alloc_, n) : nullptr;
+    }
+
+    void deallocate(value_type *ptr, size_type n) noexcept // doesn't call the destructor!
+    {
+      if (ptr) {
+        alloc_traits::deallocate(alloc_, ptr, n);
+      }
+    }
+
+    // destroys the elements and frees the buffer, leaving *this without storage
+    void release() noexcept
+    {
+      clear();
+      deallocate(array_, capacity_array_);
+      array_ = nullptr;
+      gap_begin_ = gap_end_ = capacity_array_ = 0;
+    }
+
+    // takes the buffer and the gap of v, leaving v without storage; *this must have none
+    void steal(gap_vector &v) noexcept
+    {
+      array_ = v.array_;
+      gap_begin_ = v.gap_begin_;
+      gap_end_ = v.gap_end_;
+      capacity_array_ = v.capacity_array_;
+      v.array_ = nullptr;
+      v.gap_begin_ = v.gap_end_ = v.capacity_array_ = 0;
+    }
+
+    // moves the gap to index and makes it at least k slots wide
+    void open_gap(size_type index, size_type k)
+    {
+      if (index > size()) {
+        throw std::out_of_range("Invalid pointer");
+      }
+      if (gap_size() < k) {
+        reallocate(recommend(size() + k));
+      }
+      move_gap(index);
+    }
+
+    // moves both sides of the gap into a buffer of new_capacity elements; the gap
+    // stays at the same index and absorbs the difference in capacity
+    void reallocate(size_type new_capacity)
+    {
+      value_type *new_array = allocate(new_capacity);
+      size_type tail = capacity_array_ - gap_end_;
+      try {
+        detail::relocate(alloc_, array_, array_ + gap_begin_, new_array);
+      } catch (...) {
+          deallocate(new_array, new_capacity);
+          throw;
+      }
+      try {
+        detail::relocate(alloc_, array_ + gap_end_, array_ + capacity_array_, new_array + new_capacity - tail);
+      } catch (...) {
+          detail::destroy(alloc_, new_array, new_array + gap_begin_);  // the front already left the old buffer: it is lost
+          deallocate(new_array, new_capacity);
+          gap_begin_ = 0;
+          throw;
+      }
+      deallocate(array_, capacity_array_);
+      array_ = new_array;
+      gap_end_ = new_capacity - tail;
+      capacity_array_ = new_capacity;
+    }
+
+    // capacity to grow to for required elements, as the growth policy sees it
+    size_type recommend(size_type required) const
+    {
+      size_type limit = max_size();
+      if (required > limit) {
+        throw std::length_error("gap_vector: size exceeds max_size()");
+      }
+      std::size_t grown = GrowthPolicy::grow(capacity_array_, required, sizeof(value_type));
+      return grown < limit ? static_cast<size_type>(grown) : limit;
+    }
+
+    [[no_unique_address]] Allocator alloc_;
+    T *array_;
+    size_type gap_begin_;  // elements [0, gap_begin_) come before the gap
+    size_type gap_end_;  // elements [gap_end_, capacity_array_) come after it
+    size_type capacity_array_;
+  };
+
+}
+
+#endif  // SRC_S21_GAP_VECTOR_H_
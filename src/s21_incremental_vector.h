@@ -0,0 +1,515 @@
+#ifndef SRC_S21_INCREMENTAL_VECTOR_H_
+#define SRC_S21_INCREMENTAL_VECTOR_H_
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // Vector that grows without a pause. When s21_vector is full, push_back
+  // relocates every element into the new buffer at once, which for a large
+  // vector is one very slow push. Here the full buffer is kept instead: the
+  // new one is allocated, the pushed element goes straight into it, and every
+  // following push_back, emplace_back or pop_back moves at most Step elements
+  // (more if the growth policy leaves fewer pushes than that to finish) from
+  // the old buffer over. While both are live, elements [0, pending) are still
+  // in the old buffer and the rest in the new one, so indexing costs one
+  // compare, and no operation relocates more than O(Step) elements. Iterators
+  // are index based; data() finishes the migration first.
+  template <typename T, std::size_t Step = 16, typename Allocator = std::allocator<T>, typename GrowthPolicy = growth::doubling<>>
+  class incremental_vector
+  {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static_assert(Step > 0, "incremental_vector: each step has to move at least one element");
+    static_assert(!std::is_same<T, bool>::value, "incremental_vector: no bit-packed variant, store char");
+
+    template <bool Const>
+    class incremental_iterator;
+
+  public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using growth_policy = GrowthPolicy;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = typename alloc_traits::size_type;
+    using difference_type = typename alloc_traits::difference_type;
+    using iterator = incremental_iterator<false>;
+    using const_iterator = incremental_iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    incremental_vector() noexcept(noexcept(Allocator())) : incremental_vector(Allocator()) {} // default constructor, creates empty vector
+
+    explicit incremental_vector(const Allocator &alloc) noexcept // creates empty vector which will allocate from alloc
+        : alloc_(alloc), array_(nullptr), size_array_(0), capacity_array_(0),
+          old_array_(nullptr), old_capacity_(0), pending_(0), step_(Step) {}
+
+    incremental_vector(std::initializer_list<value_type> const &items, const Allocator &alloc = Allocator()) // initializer list constructor
+        : incremental_vector(alloc)
+    {
+      reserve(items.size());
+      for (const_reference item : items) {
+        emplace_back(item);
+      }
+    }
+
+    incremental_vector(const incremental_vector &v) // copy constructor, the copy is in one buffer
+        : incremental_vector(alloc_traits::select_on_container_copy_construction(v.alloc_))
+    {
+      reserve(v.size_array_);
+      for (const_reference item : v) {
+        emplace_back(item);
+      }
+    }
+
+    incremental_vector(incremental_vector &&v) noexcept // move constructor, takes both buffers of v
+        : incremental_vector(v.alloc_)
+    {
+      steal(v);
+    }
+
+    incremental_vector &operator=(const incremental_vector &v) // copy assignment, the copy is built aside in the allocator *this ends up with
+    {
+      if (this != &v) {
+        incremental_vector tmp(alloc_traits::propagate_on_container_copy_assignment::value ? v.alloc_ : alloc_);
+        tmp.reserve(v.size_array_);
+        for (const_reference item : v) {
+          tmp.emplace_back(item);
+        }
+        release();
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          alloc_ = v.alloc_;
+        }
+        steal(tmp);
+      }
+      return *this;
+    }
+
+    incremental_vector &operator=(incremental_vector &&v) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) // assignment operator overload for moving object
+    {
+      if (this != &v) {
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          release();
+          alloc_ = v.alloc_;
+          steal(v);
+        } else {
+            if (alloc_traits::is_always_equal::value || alloc_ == v.alloc_) {
+              release();
+              steal(v);
+            } else {  // v's buffers can't be freed through our allocator: move the elements over one by one
+                clear();
+                reserve(v.size_array_);
+                for (reference item : v) {
+                  emplace_back(std::move(item));
+                }
+            }
+        }
+      }
+      return *this;
+    }
+
+    ~incremental_vector() noexcept // destructor
+    {
+      clear();
+      deallocate(array_, capacity_array_);
+    }
+
+    allocator_type get_allocator() const noexcept
+    {
+      return alloc_;
+    }
+
+// Capacity =====================================================================================
+    bool empty() const noexcept // checks whether the container is empty
+    {
+      return size_array_ ? false : true;
+    }
+
+    size_type size() const noexcept  // returns the number of elements
+    {
+      return size_array_;
+    }
+
+    size_type max_size() const noexcept // returns the maximum possible number of elements
+    {
+      size_type by_size = static_cast<size_type>(static_cast<size_type>(-1) / sizeof(value_type) / 2);
+      size_type by_alloc = alloc_traits::max_size(alloc_);
+      return by_size < by_alloc ? by_size : by_alloc;
+    }
+
+    void reserve(size_type new_capacity)  // grows in one step like s21_vector::reserve, finishing any migration first
+    {
+      if (new_capacity > max_size()) {
+        throw std::length_error("incremental_vector::reserve: capacity exceeds max_size()");
+      }
+      if (new_capacity > capacity_array_) {
+        finish_migration();
+        value_type *new_array = allocate(new_capacity);
+        try {
+          detail::relocate(alloc_, array_, array_ + size_array_, new_array);
+        } catch (...) {
+            deallocate(new_array, new_capacity);
+            throw;
+        }
+        deallocate(array_, capacity_array_);
+        array_ = new_array;
+        capacity_array_ = new_capacity;
+      }
+    }
+
+    size_type capacity() const noexcept // returns the number of elements the current buffer holds
+    {
+      return capacity_array_;
+    }
+
+    bool migrating() const noexcept  // checks whether some elements still live in the previous buffer
+    {
+      return old_array_ != nullptr;
+    }
+
+    size_type pending() const noexcept  // elements still to be moved out of the previous buffer
+    {
+      return pending_;
+    }
+
+    void migrate(size_type n)  // moves up to n more elements out of the previous buffer
+    {
+      if (!migrating()) {
+        return;
+      }
+      size_type count = n < pending_ ? n : pending_;
+      detail::relocate(alloc_, old_array_ + pending_ - count, old_array_ + pending_, array_ + pending_ - count);
+      pending_ -= count;
+      if (pending_ == 0) {
+        deallocate(old_array_, old_capacity_);
+        old_array_ = nullptr;
+        old_capacity_ = 0;
+      }
+    }
+
+    void finish_migration()  // moves the rest at once, after which the elements are contiguous again
+    {
+      migrate(pending_);
+    }
+
+// Modifiers ====================================================================================
+    void clear() noexcept  // clears the contents, keeps the current buffer and frees the previous one
+    {
+      detail::destroy(alloc_, old_array_, old_array_ + pending_);
+      detail::destroy(alloc_, array_ + pending_, array_ + size_array_);
+      deallocate(old_array_, old_capacity_);
+      old_array_ = nullptr;
+      old_capacity_ = 0;
+      pending_ = 0;
+      size_array_ = 0;
+    }
+
+    void push_back(const_reference value)
+    {
+      emplace_back(value);
+    }
+
+    void push_back(value_type &&value)  // appends value by moving it
+    {
+      emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)  // constructs an element at the end, moving at most a step of old elements
+    {
+      if (migrating()) {
+        value_type tmp(std::forward<Args>(args)...);  // args may be an element the step is about to move
+        migrate(step_);
+        return append(std::move(tmp));
+      }
+      return append(std::forward<Args>(args)...);
+    }
+
+    void pop_back() // removes the last element
+    {
+      migrate(step_);
+      --size_array_;
+      alloc_traits::destroy(alloc_, &(*this)[size_array_]);
+      if (size_array_ < pending_) {
+        pending_ = size_array_;
+        migrate(0);  // frees the previous buffer once it is empty
+      }
+    }
+
+    void swap(incremental_vector &other) noexcept(
+        alloc_traits::propagate_on_container_swap::value || alloc_traits::is_always_equal::value) // swaps the buffers; with unequal allocators that don't propagate the elements are moved
+    {
+      if (alloc_traits::propagate_on_container_swap::value || alloc_traits::is_always_equal::value || alloc_ == other.alloc_) {
+        std::swap(array_, other.array_);
+        std::swap(size_array_, other.size_array_);
+        std::swap(capacity_array_, other.capacity_array_);
+        std::swap(old_array_, other.old_array_);
+        std::swap(old_capacity_, other.old_capacity_);
+        std::swap(pending_, other.pending_);
+        std::swap(step_, other.step_);
+        if constexpr (alloc_traits::propagate_on_container_swap::value) {
+          std::swap(alloc_, other.alloc_);
+        }
+      } else {
+          incremental_vector tmp(std::move(other));
+          other = std::move(*this);
+          *this = std::move(tmp);
+      }
+    }
+
+// Element access =============================================================================
+    reference at(size_type j) // access specified element with bounds checking
+    {
+      if (j >= size_array_) {
+        throw std::out_of_range("incremental_vector::at: index out of range");
+      }
+      return (*this)[j];
+    }
+
+    const_reference at(size_type j) const
+    {
+      if (j >= size_array_) {
+        throw std::out_of_range("incremental_vector::at: index out of range");
+      }
+      return (*this)[j];
+    }
+
+    reference operator[](size_type j) noexcept // access specified element in whichever buffer holds it
+    {
+      return j < pending_ ? old_array_[j] : array_[j];
+    }
+
+    const_reference operator[](size_type j) const noexcept // access specified element in whichever buffer holds it
+    {
+      return j < pending_ ? old_array_[j] : array_[j];
+    }
+
+    reference front() noexcept // access the first element
+    {
+      return (*this)[0];
+    }
+
+    const_reference front() const noexcept // access the first element
+    {
+      return (*this)[0];
+    }
+
+    reference back() noexcept // access the last element
+    {
+      return (*this)[size_array_ - 1];
+    }
+
+    const_reference back() const noexcept // access the last element
+    {
+      return (*this)[size_array_ - 1];
+    }
+
+    value_type *data()  // direct access to the elements, finishing the migration first
+    {
+      finish_migration();
+      return array_;
+    }
+
+// Iterators ====================================================================================
+    iterator begin() noexcept  // returns an iterator to the beginning
+    {
+      return iterator(this, 0);
+    }
+
+    const_iterator begin() const noexcept
+    {
+      return const_iterator(this, 0);
+    }
+
+    iterator end() noexcept  // returns an iterator to the end
+    {
+      return iterator(this, static_cast<difference_type>(size_array_));
+    }
+
+    const_iterator end() const noexcept
+    {
+      return const_iterator(this, static_cast<difference_type>(size_array_));
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+    reverse_iterator rbegin() noexcept  // returns a reverse iterator to the last element
+    {
+      return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+      return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept  // returns a reverse iterator past the first element
+    {
+      return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+      return const_reverse_iterator(begin());
+    }
+
+  private:
+    template <bool Const>
+    class incremental_iterator {  // random access by index; dereferencing picks the buffer
+      friend class incremental_vector;
+      friend class incremental_iterator<!Const>;
+
+      using container_pointer = std::conditional_t<Const, const incremental_vector *, incremental_vector *>;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        incremental_iterator() : container_(nullptr), index_(0) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        incremental_iterator(const incremental_iterator<false> &other) : container_(other.container_), index_(other.index_) {}
+
+        reference operator*() const { return (*container_)[static_cast<size_type>(index_)]; }
+        pointer operator->() const { return &**this; }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        incremental_iterator &operator++() { ++index_; return *this; }
+        incremental_iterator operator++(int) { incremental_iterator tmp(*this); ++index_; return tmp; }
+        incremental_iterator &operator--() { --index_; return *this; }
+        incremental_iterator operator--(int) { incremental_iterator tmp(*this); --index_; return tmp; }
+        incremental_iterator &operator+=(difference_type n) { index_ += n; return *this; }
+        incremental_iterator &operator-=(difference_type n) { index_ -= n; return *this; }
+
+        friend incremental_iterator operator+(incremental_iterator it, difference_type n) { return it += n; }
+        friend incremental_iterator operator+(difference_type n, incremental_iterator it) { return it += n; }
+        friend incremental_iterator operator-(incremental_iterator it, difference_type n) { return it -= n; }
+
+        template <bool C>
+        difference_type operator-(const incremental_iterator<C> &other) const { return index_ - other.index_; }
+        template <bool C>
+        bool operator==(const incremental_iterator<C> &other) const { return index_ == other.index_; }
+        template <bool C>
+        bool operator!=(const incremental_iterator<C> &other) const { return index_ != other.index_; }
+        template <bool C>
+        bool operator<(const incremental_iterator<C> &other) const { return index_ < other.index_; }
+        template <bool C>
+        bool operator>(const incremental_iterator<C> &other) const { return index_ > other.index_; }
+        template <bool C>
+        bool operator<=(const incremental_iterator<C> &other) const { return index_ <= other.index_; }
+        template <bool C>
+        bool operator>=(const incremental_iterator<C> &other) const { return index_ >= other.index_; }
+
+      private:
+        incremental_iterator(container_pointer container, difference_type index) : container_(container), index_(index) {}
+
+        container_pointer container_;
+        difference_type index_;
+    };
+
+    value_type *allocate(size_type n)
+    {
+      return n ? alloc_traits::allocate(alloc_, n) : nullptr;
+    }
+
+    void deallocate(value_type *ptr, size_type n) noexcept // doesn't call the destructor!
+    {
+      if (ptr) {
+        alloc_traits::deallocate(alloc_, ptr, n);
+      }
+    }
+
+    // destroys the elements and frees both buffers, leaving *this without storage
+    void release() noexcept
+    {
+      clear();
+      deallocate(array_, capacity_array_);
+      array_ = nullptr;
+      capacity_array_ = 0;
+    }
+
+    // takes both buffers of v and its migration state, leaving v without storage; *this must have none
+    void steal(incremental_vector &v) noexcept
+    {
+      array_ = v.array_;
+      size_array_ = v.size_array_;
+      capacity_array_ = v.capacity_array_;
+      old_array_ = v.old_array_;
+      old_capacity_ = v.old_capacity_;
+      pending_ = v.pending_;
+      step_ = v.step_;
+      v.array_ = v.old_array_ = nullptr;
+      v.size_array_ = v.capacity_array_ = v.old_capacity_ = v.pending_ = 0;
+      v.step_ = Step;
+    }
+
+    // constructs the last element; when the buffer is full the new one is allocated
+    // and only the new element goes into it, the others migrate step by step later
+    template <typename... Args>
+    reference append(Args&&... args)
+    {
+      if (size_array_ == capacity_array_) {
+        finish_migration();  // only reachable with a policy that grows by less than the step can keep up with
+        size_type new_capacity = recommend(size_array_ + 1);
+        value_type *new_array = allocate(new_capacity);
+        try {
+          alloc_traits::construct(alloc_, new_array + size_array_, std::forward<Args>(args)...);
+        } catch (...) {
+            deallocate(new_array, new_capacity);
+            throw;
+        }
+        if (size_array_) {
+          old_array_ = array_;
+          old_capacity_ = capacity_array_;
+          pending_ = size_array_;
+          size_type room = new_capacity - size_array_;
+          size_type needed = (pending_ + room - 1) / room;  // done before the new buffer is full
+          step_ = needed > Step ? needed : Step;
+        } else {
+            deallocate(array_, capacity_array_);
+        }
+        array_ = new_array;
+        capacity_array_ = new_capacity;
+      } else {
+          alloc_traits::construct(alloc_, array_ + size_array_, std::forward<Args>(args)...);
+      }
+      return array_[size_array_++];
+    }
+
+    // capacity to grow to for required elements, as the growth policy sees it
+    size_type recommend(size_type required) const
+    {
+      size_type limit = max_size();
+      if (required > limit) {
+        throw std::length_error("incremental_vector: size exceeds max_size()");
+      }
+      std::size_t grown = GrowthPolicy::grow(capacity_array_, required, sizeof(value_type));
+      return grown < limit ? static_cast<size_type>(grown) : limit;
+    }
+
+    [[no_unique_address]] Allocator alloc_;
+    T *array_;  // the current buffer: holds [pending_, size_array_)
+    size_type size_array_;
+    size_type capacity_array_;
+    T *old_array_;  // the buffer outgrown last, holds [0, pending_); nullptr once it is empty
+    size_type old_capacity_;
+    size_type pending_;
+    size_type step_;  // elements moved per operation until the migration is done
+  };
+
+}
+
+#endif  // SRC_S21_INCREMENTAL_VECTOR_H_
@@ -1,3 +1,6 @@
+#ifndef SRC_S21_LIST_H_
+#define SRC_S21_LIST_H_
+
 #include <iostream>
 #include <limits>
 
@@ -348,4 +351,6 @@ namespace s21
             // отсортировать сначала левую сторону потом правую
         }
     };
-}
\ No newline at end of file
+}
+
+#endif  // SRC_S21_LIST_H_
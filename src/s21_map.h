@@ -1,3 +1,6 @@
+#ifndef SRC_S21_MAP_H_
+#define SRC_S21_MAP_H_
+
 #ifndef GRANDFATHER_H
 #define GRANDFATHER_H
 #include "rbtree.h"
@@ -123,4 +126,6 @@ namespace s21
             bool operator()(const_reference a, const_reference b) const { return a.first < b.first; }
         };
     };
-}
\ No newline at end of file
+}
+
+#endif  // SRC_S21_MAP_H_
@@ -0,0 +1,495 @@
+#ifndef SRC_S21_MAPPED_VECTOR_H_
+#define SRC_S21_MAPPED_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <system_error>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  enum class map_mode {
+    create,      // truncates the file, or creates it, to an empty vector
+    read_write,  // opens the vector stored in the file, creating an empty one if there is none
+    read_only    // opens an existing vector; the pages are shared with every other reader
+  };
+
+  // s21_vector whose elements live in a file (Linux only). The file is a 64-byte
+  // header followed by the elements exactly as they are in memory, so opening it is
+  // one mmap and no parsing; growing it is ftruncate plus mremap. Only trivially
+  // copyable types can be stored, and the header records the element size so a
+  // file written for another type or layout is refused instead of misread.
+  // Readers take the size at open(): elements appended afterwards by a writer
+  // become visible to them by opening the file again.
+  template <typename T, typename GrowthPolicy = growth::doubling<>>
+  class mapped_vector
+  {
+    static_assert(std::is_trivially_copyable<T>::value, "mapped_vector: elements are stored as raw bytes");
+    static_assert(!std::is_same<T, bool>::value, "mapped_vector: borrows s21_vector<T>::iterator, which is a bit iterator for bool");
+
+  public:
+    using value_type = T;
+    using growth_policy = GrowthPolicy;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = typename s21_vector<T>::iterator;
+    using const_iterator = typename s21_vector<T>::const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr std::uint32_t format_version = 1;
+
+    struct header {
+      char magic[8];
+      std::uint32_t version;
+      std::uint32_t element_size;
+      std::uint32_t element_align;
+      std::uint32_t reserved;
+      std::uint64_t size;
+      unsigned char padding[32];
+    };
+
+    static_assert(sizeof(header) == 64, "mapped_vector: the header is part of the file format");
+    static_assert(alignof(T) <= sizeof(header), "mapped_vector: elements must stay aligned after the header");
+
+    mapped_vector() noexcept : fd_(-1), read_only_(false), header_(nullptr), mapped_bytes_(0), array_(nullptr), size_array_(0), capacity_array_(0) {} // default constructor, not backed by any file
+
+    explicit mapped_vector(const std::string &path, map_mode mode = map_mode::read_write) : mapped_vector() // maps the vector stored in path
+    {
+      open(path, mode);
+    }
+
+    mapped_vector(const mapped_vector &) = delete;
+
+    mapped_vector(mapped_vector &&v) noexcept : mapped_vector() // move constructor
+    {
+      swap(v);
+    }
+
+    mapped_vector &operator=(const mapped_vector &) = delete;
+
+    mapped_vector &operator=(mapped_vector &&v) noexcept // assignment operator overload for moving object
+    {
+      if (this != &v) {
+        close();
+        swap(v);
+      }
+      return *this;
+    }
+
+    ~mapped_vector() noexcept // destructor, unmaps and closes the file; nothing is flushed synchronously
+    {
+      close();
+    }
+
+    void open(const std::string &path, map_mode mode = map_mode::read_write)  // closes the current file and maps path
+    {
+      close();
+      int flags = mode == map_mode::read_only ? O_RDONLY : O_RDWR | O_CREAT | (mode == map_mode::create ? O_TRUNC : 0);
+      fd_ = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+      if (fd_ < 0) {
+        throw std::system_error(errno, std::generic_category(), "mapped_vector: cannot open " + path);
+      }
+      read_only_ = mode == map_mode::read_only;
+      try {
+        struct stat st;
+        if (fstat(fd_, &st) != 0) {
+          throw std::system_error(errno, std::generic_category(), "mapped_vector: cannot stat " + path);
+        }
+        std::size_t file_size = static_cast<std::size_t>(st.st_size);
+        if (file_size == 0 && !read_only_) {
+          file_size = sizeof(header);
+          resize_file(file_size);
+          map(file_size);
+          init_header();
+        } else {
+            if (file_size < sizeof(header)) {
+              throw std::runtime_error("mapped_vector: " + path + " is not a mapped_vector file");
+            }
+            map(file_size);
+            check_header(path);
+        }
+        capacity_array_ = (file_size - sizeof(header)) / sizeof(T);
+        size_array_ = static_cast<size_type>(header_->size);
+        if (size_array_ > capacity_array_) {
+          throw std::runtime_error("mapped_vector: " + path + " is truncated");
+        }
+      } catch (...) {
+          close();
+          throw;
+      }
+    }
+
+    void close() noexcept  // unmaps and closes the file; a vector can be opened again afterwards
+    {
+      if (header_) {
+        munmap(header_, mapped_bytes_);
+      }
+      if (fd_ >= 0) {
+        ::close(fd_);
+      }
+      fd_ = -1;
+      read_only_ = false;
+      header_ = nullptr;
+      mapped_bytes_ = 0;
+      array_ = nullptr;
+      size_array_ = 0;
+      capacity_array_ = 0;
+    }
+
+    bool is_open() const noexcept
+    {
+      return header_ != nullptr;
+    }
+
+    bool is_read_only() const noexcept
+    {
+      return read_only_;
+    }
+
+    void flush()  // writes the dirty pages back to the file and waits for it
+    {
+      if (header_ && !read_only_ && msync(header_, mapped_bytes_, MS_SYNC) != 0) {
+        throw std::system_error(errno, std::generic_category(), "mapped_vector: msync failed");
+      }
+    }
+
+// Capacity =====================================================================================
+    bool empty() const noexcept // checks whether the container is empty
+    {
+      return size_array_ ? false : true;
+    }
+
+    size_type size() const noexcept  // returns the number of elements
+    {
+      return size_array_;
+    }
+
+    size_type max_size() const noexcept // returns the maximum possible number of elements
+    {
+      size_type j = 0;
+      return (j - 1 - sizeof(header)) / sizeof(value_type) / 2;
+    }
+
+    void reserve(size_type new_capacity_array_)  // grows the file to hold new_capacity_array_ elements and remaps it
+    {
+      if (new_capacity_array_ > capacity_array_) {
+        reallocate(new_capacity_array_);
+      }
+    }
+
+    void resize(size_type new_size_array, const_reference value = T())
+    {
+      writable();
+      if (new_size_array > size_array_) {
+        value_type tmp(value);  // value may live in the mapping reserve is about to move
+        reserve(new_size_array);
+        for (size_type j = size_array_; j != new_size_array; ++j) {
+          array_[j] = tmp;
+        }
+      }
+      set_size(new_size_array);
+    }
+
+    size_type capacity() const noexcept // returns the number of elements the file currently has room for
+    {
+      return capacity_array_;
+    }
+
+    void shrink_to_fit()  // truncates the file to the elements it holds
+    {
+      if (capacity_array_ > size_array_) {
+        reallocate(size_array_);
+      }
+    }
+
+// Modifiers ====================================================================================
+    void clear()  // clears the contents; the file keeps its length
+    {
+      writable();
+      set_size(0);
+    }
+
+    void push_back(const_reference value)  // adds an element to the end
+    {
+      writable();
+      if (size_array_ == capacity_array_) {
+        value_type tmp(value);  // value may live in the mapping reserve is about to move
+        reallocate(GrowthPolicy::grow(capacity_array_, size_array_ + 1, sizeof(T)));
+        array_[size_array_] = tmp;
+      } else {
+          array_[size_array_] = value;
+      }
+      set_size(size_array_ + 1);
+    }
+
+    template <typename InputIt>
+    void append_range(InputIt first, InputIt last)  // appends a copy of [first, last), growing the file at most once for forward ranges
+    {
+      writable();
+      if constexpr (detail::is_forward_iterator<InputIt>::value) {
+        size_type n = static_cast<size_type>(std::distance(first, last));
+        if (capacity_array_ - size_array_ < n) {
+          reallocate(GrowthPolicy::grow(capacity_array_, size_array_ + n, sizeof(T)));
+        }
+        for (size_type j = size_array_; first != last; ++first, ++j) {
+          array_[j] = *first;
+        }
+        set_size(size_array_ + n);
+      } else {
+          for (; first != last; ++first) {
+            push_back(*first);
+          }
+      }
+    }
+
+    void pop_back()  // removes the last element
+    {
+      writable();
+      set_size(size_array_ - 1);
+    }
+
+    void swap(mapped_vector &other) noexcept  // swaps the files
+    {
+      std::swap(fd_, other.fd_);
+      std::swap(read_only_, other.read_only_);
+      std::swap(header_, other.header_);
+      std::swap(mapped_bytes_, other.mapped_bytes_);
+      std::swap(array_, other.array_);
+      std::swap(size_array_, other.size_array_);
+      std::swap(capacity_array_, other.capacity_array_);
+    }
+
+// Element access =============================================================================
+
+    reference at(size_type j) // access specified element with bounds checking
+    {
+      if (j >= size_array_) {
+        throw std::out_of_range("mapped_vector::at: index out of range");
+      }
+      return array_[j];
+    }
+
+    const_reference at(size_type j) const
+    {
+      if (j >= size_array_) {
+        throw std::out_of_range("mapped_vector::at: index out of range");
+      }
+      return array_[j];
+    }
+
+    // the mapping of a read-only vector is PROT_READ: writing through the
+    // non-const accessors of one is a segmentation fault, use it as const
+    reference operator[](size_type j) noexcept // access specified element
+    {
+      return array_[j];
+    }
+
+    const_reference operator[](size_type j) const noexcept // access specified element
+    {
+      return array_[j];
+    }
+
+    reference front() noexcept // access the first element
+    {
+      return array_[0];
+    }
+
+    const_reference front() const noexcept // access the first element
+    {
+      return array_[0];
+    }
+
+    reference back() noexcept // access the last element
+    {
+      return array_[size_array_ - 1];
+    }
+
+    const_reference back() const noexcept // access the last element
+    {
+      return array_[size_array_ - 1];
+    }
+
+    value_type * data() noexcept  // direct access to the mapped elements
+    {
+      return array_;
+    }
+
+    const value_type * data() const noexcept  // direct access to the mapped elements
+    {
+      return array_;
+    }
+
+// Iterators ====================================================================================
+
+    iterator begin() noexcept  // returns an iterator to the beginning
+    {
+      return iterator(array_);
+    }
+
+    const_iterator begin() const noexcept
+    {
+      return const_iterator(array_);
+    }
+
+    iterator end() noexcept  // returns an iterator to the end
+    {
+      return iterator(array_ + size_array_);
+    }
+
+    const_iterator end() const noexcept
+    {
+      return const_iterator(array_ + size_array_);
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+    reverse_iterator rbegin() noexcept  // returns a reverse iterator to the last element
+    {
+      return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+      return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept  // returns a reverse iterator past the first element
+    {
+      return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crbegin() const noexcept
+    {
+      return rbegin();
+    }
+
+    const_reverse_iterator crend() const noexcept
+    {
+      return rend();
+    }
+
+  private:
+    static constexpr char magic_[8] = {'s', '2', '1', 'm', 'v', 'e', 'c', '\0'};
+
+    void writable() const  // refuses to modify a read-only or closed vector before touching the mapping
+    {
+      if (!header_ || read_only_) {
+        throw std::logic_error("mapped_vector: not opened for writing");
+      }
+    }
+
+    void set_size(size_type n) noexcept
+    {
+      size_array_ = n;
+      header_->size = n;
+    }
+
+    void resize_file(std::size_t bytes)
+    {
+      if (ftruncate(fd_, static_cast<off_t>(bytes)) != 0) {
+        throw std::system_error(errno, std::generic_category(), "mapped_vector: ftruncate failed");
+      }
+    }
+
+    void map(std::size_t bytes)
+    {
+      int prot = read_only_ ? PROT_READ : PROT_READ | PROT_WRITE;
+      void *ptr = mmap(nullptr, bytes, prot, MAP_SHARED, fd_, 0);
+      if (ptr == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "mapped_vector: mmap failed");
+      }
+      header_ = static_cast<header*>(ptr);
+      mapped_bytes_ = bytes;
+      array_ = reinterpret_cast<T*>(static_cast<unsigned char*>(ptr) + sizeof(header));
+    }
+
+    void init_header() noexcept
+    {
+      std::memcpy(header_->magic, magic_, sizeof(magic_));
+      header_->version = format_version;
+      header_->element_size = sizeof(T);
+      header_->element_align = alignof(T);
+      header_->reserved = 0;
+      header_->size = 0;
+      std::memset(header_->padding, 0, sizeof(header_->padding));
+    }
+
+    void check_header(const std::string &path) const
+    {
+      if (std::memcmp(header_->magic, magic_, sizeof(magic_)) != 0) {
+        throw std::runtime_error("mapped_vector: " + path + " is not a mapped_vector file");
+      }
+      if (header_->version != format_version) {
+        throw std::runtime_error("mapped_vector: " + path + " has format version " + std::to_string(header_->version));
+      }
+      if (header_->element_size != sizeof(T) || header_->element_align != alignof(T)) {
+        throw std::runtime_error("mapped_vector: " + path + " holds elements of " + std::to_string(header_->element_size) +
+                                 " bytes, expected " + std::to_string(sizeof(T)));
+      }
+    }
+
+    void reallocate(size_type new_capacity)  // resizes the file to new_capacity elements, rounded up to whole pages, and remaps it
+    {
+      writable();
+      static const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+      std::size_t bytes = sizeof(header) + new_capacity * sizeof(T);
+      bytes = (bytes + page - 1) / page * page;
+      new_capacity = (bytes - sizeof(header)) / sizeof(T);
+      if (new_capacity < capacity_array_) {  // unmap the tail before cutting it off the file
+        remap(bytes);
+        capacity_array_ = new_capacity;
+        resize_file(bytes);
+      } else {
+          resize_file(bytes);
+          remap(bytes);
+          capacity_array_ = new_capacity;
+      }
+    }
+
+    void remap(std::size_t bytes)
+    {
+      void *ptr = mremap(header_, mapped_bytes_, bytes, MREMAP_MAYMOVE);
+      if (ptr == MAP_FAILED) {
+        throw std::system_error(errno, std::generic_category(), "mapped_vector: mremap failed");
+      }
+      header_ = static_cast<header*>(ptr);
+      mapped_bytes_ = bytes;
+      array_ = reinterpret_cast<T*>(static_cast<unsigned char*>(ptr) + sizeof(header));
+    }
+
+    int fd_;
+    bool read_only_;
+    header *header_;
+    std::size_t mapped_bytes_;  // length of the mapping, which may end in a partial element
+    T *array_;
+    size_type size_array_;
+    size_type capacity_array_;
+  };
+
+}
+
+#endif  // SRC_S21_MAPPED_VECTOR_H_
@@ -0,0 +1,100 @@
+#ifndef SRC_S21_MMAP_ALLOCATOR_H_
+#define SRC_S21_MMAP_ALLOCATOR_H_
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <new>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // Allocator for very large buffers (Linux only): every allocation is its own
+  // anonymous mapping advised for transparent huge pages. It offers reallocate(),
+  // so an s21_vector of trivially relocatable elements grows and shrinks through
+  // mremap: the kernel moves page table entries instead of copying bytes, and the
+  // old and the new buffer never occupy memory at the same time.
+  template <typename T>
+  class mmap_allocator
+  {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using is_always_equal = std::true_type;
+
+    static constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+    mmap_allocator() noexcept = default;
+
+    template <typename U>
+    mmap_allocator(const mmap_allocator<U> &) noexcept {}
+
+    T *allocate(size_type n)  // maps at least n elements worth of whole pages
+    {
+      std::size_t bytes = mapping_size(n);
+      void *ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (ptr == MAP_FAILED) {
+        throw std::bad_alloc();
+      }
+      advise_huge(ptr, bytes);
+      return static_cast<T*>(ptr);
+    }
+
+    void deallocate(T *ptr, size_type n) noexcept
+    {
+      munmap(ptr, mapping_size(n));
+    }
+
+    // resizes the mapping holding old_n elements to new_n, moving it if it has to;
+    // shrinking unmaps the tail, which hands those pages straight back to the kernel
+    T *reallocate(T *ptr, size_type old_n, size_type new_n)
+    {
+      std::size_t old_bytes = mapping_size(old_n);
+      std::size_t new_bytes = mapping_size(new_n);
+      if (old_bytes == new_bytes) {
+        return ptr;
+      }
+      void *moved = mremap(ptr, old_bytes, new_bytes, MREMAP_MAYMOVE);
+      if (moved == MAP_FAILED) {
+        throw std::bad_alloc();
+      }
+      if (new_bytes > old_bytes) {
+        advise_huge(moved, new_bytes);
+      }
+      return static_cast<T*>(moved);
+    }
+
+    static std::size_t mapping_size(size_type n) noexcept  // n elements rounded up to whole pages
+    {
+      static const std::size_t page = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+      std::size_t bytes = n * sizeof(T);
+      return (bytes + page - 1) / page * page;
+    }
+
+    friend bool operator==(const mmap_allocator &, const mmap_allocator &) noexcept { return true; }
+    friend bool operator!=(const mmap_allocator &, const mmap_allocator &) noexcept { return false; }
+
+  private:
+    static void advise_huge(void *ptr, std::size_t bytes) noexcept  // a hint: the kernel may not have THP enabled
+    {
+#ifdef MADV_HUGEPAGE
+      if (bytes >= huge_page_size) {
+        madvise(ptr, bytes, MADV_HUGEPAGE);
+      }
+#else
+      (void)ptr;
+      (void)bytes;
+#endif
+    }
+  };
+
+  // s21_vector for multi-gigabyte tables: mmap-backed, huge pages, mremap growth
+  template <typename T, typename GrowthPolicy = growth::doubling<>>
+  using mmap_vector = s21_vector<T, mmap_allocator<T>, GrowthPolicy>;
+
+}
+
+#endif  // SRC_S21_MMAP_ALLOCATOR_H_
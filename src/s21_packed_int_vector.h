@@ -0,0 +1,368 @@
+#ifndef SRC_S21_PACKED_INT_VECTOR_H_
+#define SRC_S21_PACKED_INT_VECTOR_H_
+
+#include "s21_simd.h"
+
+#ifdef S21_SIMD_X86
+#define S21_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#endif
+
+namespace s21 {
+
+  enum class packing {
+    frame_of_reference,  // each value is stored as its distance from the smallest value of its block
+    delta                // each value is stored as the step from its predecessor; for sorted or clustered data
+  };
+
+  // Integer sequence stored in blocks of 128 bit-packed values. Every block
+  // keeps a base and the number of bits its largest entry needs, so values that
+  // are close to each other take a few bits instead of sizeof(T) bytes. With
+  // packing::delta the entries are the steps between neighbours (minus the
+  // smallest step), which for sorted data such as timestamps or document ids is
+  // usually a handful of bits. The newest values wait in an unpacked tail until
+  // a block is full. Random access reads one entry (frame of reference) or sums
+  // the steps up to it (delta); sequential scans should decode whole blocks with
+  // for_each_block() or decode(), which unpack with AVX2 where available.
+  template <typename T = std::uint64_t, packing Mode = packing::frame_of_reference>
+  class packed_int_vector
+  {
+    static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value, "packed_int_vector: T must be an integer type");
+
+    using U = std::make_unsigned_t<T>;
+
+    struct block_header {
+      U base;  // smallest value (frame of reference) or first value (delta)
+      U step;  // smallest step between neighbours (delta), 0 otherwise
+      std::uint64_t offset;  // first word of the block in words_
+      unsigned width;  // bits per entry, 0 to 64
+    };
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    static constexpr size_type block_size = 128;
+
+    packed_int_vector() = default; // default constructor, creates empty vector
+
+    packed_int_vector(std::initializer_list<value_type> const &items) // initializer list constructor
+    {
+      append(items.begin(), items.end());
+    }
+
+    explicit packed_int_vector(const s21_vector<value_type> &values) // packs a whole vector
+    {
+      append(values);
+    }
+
+// Capacity =====================================================================================
+    bool empty() const noexcept // checks whether the container is empty
+    {
+      return size() ? false : true;
+    }
+
+    size_type size() const noexcept  // returns the number of elements
+    {
+      return blocks_.size() * block_size + tail_.size();
+    }
+
+    size_type block_count() const noexcept  // packed blocks, the tail not included
+    {
+      return blocks_.size();
+    }
+
+    size_type memory_bytes() const noexcept  // heap bytes held: block headers, packed words and the tail buffer
+    {
+      return blocks_.capacity() * sizeof(block_header) + words_.capacity() * sizeof(std::uint64_t) +
+             tail_.capacity() * sizeof(value_type);
+    }
+
+    void shrink_to_fit()
+    {
+      blocks_.shrink_to_fit();
+      words_.shrink_to_fit();
+      tail_.shrink_to_fit();
+    }
+
+// Modifiers ====================================================================================
+    void clear() noexcept
+    {
+      blocks_.clear();
+      words_.clear();
+      tail_.clear();
+    }
+
+    void push_back(value_type value)  // appends value, packing the tail once it holds a full block; unchanged if packing throws
+    {
+      tail_.push_back(value);
+      if (tail_.size() == block_size) {
+        try {
+          pack(tail_.data());
+        } catch (...) {
+            tail_.pop_back();
+            throw;
+        }
+        tail_.clear();
+      }
+    }
+
+    void append(const value_type *first, const value_type *last)  // appends [first, last); full blocks are packed straight from the source
+    {
+      while (first != last) {
+        size_type left = static_cast<size_type>(last - first);
+        if (tail_.empty() && left >= block_size) {
+          pack(first);
+          first += block_size;
+        } else {
+            size_type take = std::min(left, block_size - tail_.size());
+            tail_.insert(tail_.cend(), first, first + take);
+            first += take;
+            if (tail_.size() == block_size) {
+              try {
+                pack(tail_.data());
+              } catch (...) {
+                  tail_.erase(tail_.cend() - static_cast<std::ptrdiff_t>(take), tail_.cend());
+                  throw;
+              }
+              tail_.clear();
+            }
+        }
+      }
+    }
+
+    template <typename A, typename G>
+    void append(const s21_vector<value_type, A, G> &values)  // bulk append of a vector
+    {
+      append(values.data(), values.data() + values.size());
+    }
+
+// Element access =============================================================================
+    value_type operator[](size_type j) const noexcept // reads element j
+    {
+      size_type block = j / block_size;
+      size_type index = j % block_size;
+      if (block == blocks_.size()) {
+        return tail_[index];
+      }
+      const block_header &header = blocks_[block];
+      const std::uint64_t *words = words_.data() + header.offset;
+      if constexpr (Mode == packing::frame_of_reference) {
+        return static_cast<value_type>(header.base + static_cast<U>(entry(words, index, header.width)));
+      } else {
+          U value = header.base;
+          for (size_type i = 1; i <= index; ++i) {
+            value += static_cast<U>(entry(words, i, header.width)) + header.step;
+          }
+          return static_cast<value_type>(value);
+      }
+    }
+
+    value_type at(size_type j) const // reads element j with bounds checking
+    {
+      if (j >= size()) {
+        throw std::out_of_range("packed_int_vector::at: index out of range");
+      }
+      return (*this)[j];
+    }
+
+    value_type front() const noexcept // reads the first element
+    {
+      return (*this)[0];
+    }
+
+    value_type back() const noexcept // reads the last element
+    {
+      return (*this)[size() - 1];
+    }
+
+// Decoding =====================================================================================
+    size_type decode_block(size_type block, value_type *out) const  // unpacks block (block_count() is the tail) into out, returns how many values it had
+    {
+      if (block == blocks_.size()) {
+        std::copy(tail_.begin(), tail_.end(), out);
+        return tail_.size();
+      }
+      if (block > blocks_.size()) {
+        throw std::out_of_range("packed_int_vector::decode_block: block out of range");
+      }
+      const block_header &header = blocks_[block];
+      const std::uint64_t *words = words_.data() + header.offset;
+#ifdef S21_SIMD_X86
+      if constexpr (sizeof(value_type) == sizeof(std::uint64_t)) {
+        if (header.width != 0 && simd::detail::active_isa() == simd::detail::isa::avx2) {
+          avx2_unpack(words, header, reinterpret_cast<std::uint64_t*>(out));
+          return block_size;
+        }
+      }
+#endif
+      scalar_unpack(words, header, out);
+      return block_size;
+    }
+
+    template <typename Function>
+    void for_each_block(Function f) const  // calls f(values, count) for every block in order, the tail last
+    {
+      alignas(32) value_type buffer[block_size];
+      for (size_type block = 0; block <= blocks_.size(); ++block) {
+        size_type count = decode_block(block, buffer);
+        if (count) {
+          f(static_cast<const value_type*>(buffer), count);
+        }
+      }
+    }
+
+    s21_vector<value_type> decode() const  // unpacks everything
+    {
+      s21_vector<value_type> values;
+      values.resize_and_overwrite(size(), [this](value_type *out, size_type) {
+        size_type written = 0;
+        for (size_type block = 0; block <= blocks_.size(); ++block) {
+          written += decode_block(block, out + written);
+        }
+        return written;
+      });
+      return values;
+    }
+
+  private:
+    static std::uint64_t mask(unsigned width) noexcept
+    {
+      return width == 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << width) - 1;
+    }
+
+    static unsigned bit_width(std::uint64_t x) noexcept
+    {
+      return x ? 64 - static_cast<unsigned>(__builtin_clzll(x)) : 0;
+    }
+
+    // the width-bit entry at index, which may straddle two words
+    static std::uint64_t entry(const std::uint64_t *words, size_type index, unsigned width) noexcept
+    {
+      if (width == 0) {
+        return 0;
+      }
+      std::size_t bit = index * width;
+      std::size_t word = bit / 64;
+      unsigned shift = bit % 64;
+      std::uint64_t value = words[word] >> shift;
+      if (shift + width > 64) {
+        value |= words[word + 1] << (64 - shift);
+      }
+      return value & mask(width);
+    }
+
+    // packs block_size values from source as a new block; words_ always ends with
+    // one spare zero word, so decoding may load the word after a block's last one.
+    // Everything that can throw happens before the block is published: if it
+    // throws, the blocks read exactly as before
+    void pack(const value_type *source)
+    {
+      if (blocks_.size() == blocks_.capacity()) {  // grow as push_back would, but before words_ changes
+        blocks_.reserve(blocks_.capacity() ? 2 * blocks_.capacity() : 8);
+      }
+      std::uint64_t entries[block_size];
+      block_header header{};
+      if constexpr (Mode == packing::frame_of_reference) {
+        value_type smallest = *std::min_element(source, source + block_size);
+        header.base = static_cast<U>(smallest);
+        for (size_type i = 0; i < block_size; ++i) {
+          entries[i] = static_cast<U>(static_cast<U>(source[i]) - header.base);
+        }
+      } else {
+          header.base = static_cast<U>(source[0]);
+          U step = static_cast<U>(static_cast<U>(source[1]) - static_cast<U>(source[0]));
+          for (size_type i = 2; i < block_size; ++i) {
+            step = std::min(step, static_cast<U>(static_cast<U>(source[i]) - static_cast<U>(source[i - 1])));
+          }
+          header.step = step;
+          entries[0] = 0;
+          for (size_type i = 1; i < block_size; ++i) {
+            entries[i] = static_cast<U>(static_cast<U>(source[i]) - static_cast<U>(source[i - 1]) - step);
+          }
+      }
+      std::uint64_t all = 0;
+      for (size_type i = 0; i < block_size; ++i) {
+        all |= entries[i];
+      }
+      header.width = bit_width(all);
+
+      if (words_.empty()) {
+        words_.push_back(0);
+      }
+      header.offset = words_.size() - 1;  // the spare word becomes the block's first
+      words_.resize(words_.size() + block_size * header.width / 64);
+      std::uint64_t *words = words_.data() + header.offset;
+      if (header.width) {
+        for (size_type i = 0; i < block_size; ++i) {
+          std::size_t bit = i * header.width;
+          unsigned shift = bit % 64;
+          words[bit / 64] |= entries[i] << shift;
+          if (shift + header.width > 64) {
+            words[bit / 64 + 1] |= entries[i] >> (64 - shift);
+          }
+        }
+      }
+      blocks_.push_back(header);
+    }
+
+    static void scalar_unpack(const std::uint64_t *words, const block_header &header, value_type *out) noexcept
+    {
+      if constexpr (Mode == packing::frame_of_reference) {
+        for (size_type i = 0; i < block_size; ++i) {
+          out[i] = static_cast<value_type>(header.base + static_cast<U>(entry(words, i, header.width)));
+        }
+      } else {
+          U value = header.base;
+          out[0] = static_cast<value_type>(value);
+          for (size_type i = 1; i < block_size; ++i) {
+            value += static_cast<U>(entry(words, i, header.width)) + header.step;
+            out[i] = static_cast<value_type>(value);
+          }
+      }
+    }
+
+#ifdef S21_SIMD_X86
+    // four entries per step: gather the two words each one may span, shift them
+    // together and mask; the base (or the smallest step) is added in the same lanes
+    S21_TARGET_AVX2 static void avx2_unpack(const std::uint64_t *words, const block_header &header, std::uint64_t *out) noexcept
+    {
+      const long long *base_words = reinterpret_cast<const long long*>(words);
+      const long long width = header.width;
+      const __m256i lane_bits = _mm256_set_epi64x(3 * width, 2 * width, width, 0);
+      const __m256i step_bits = _mm256_set1_epi64x(4 * width);
+      const __m256i low_bits = _mm256_set1_epi64x(63);
+      const __m256i sixty_four = _mm256_set1_epi64x(64);
+      const __m256i keep = _mm256_set1_epi64x(static_cast<long long>(mask(header.width)));
+      const __m256i add = _mm256_set1_epi64x(static_cast<long long>(Mode == packing::frame_of_reference ? header.base : header.step));
+      __m256i bits = lane_bits;
+      for (size_type i = 0; i < block_size; i += 4) {
+        __m256i word = _mm256_srli_epi64(bits, 6);
+        __m256i shift = _mm256_and_si256(bits, low_bits);
+        __m256i low = _mm256_i64gather_epi64(base_words, word, 8);
+        __m256i high = _mm256_i64gather_epi64(base_words + 1, word, 8);
+        __m256i value = _mm256_or_si256(_mm256_srlv_epi64(low, shift), _mm256_sllv_epi64(high, _mm256_sub_epi64(sixty_four, shift)));
+        value = _mm256_add_epi64(_mm256_and_si256(value, keep), add);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), value);
+        bits = _mm256_add_epi64(bits, step_bits);
+      }
+      if constexpr (Mode == packing::delta) {  // out holds the steps now; entry 0 got one too many
+        out[0] = header.base;
+        for (size_type i = 1; i < block_size; ++i) {
+          out[i] += out[i - 1];
+        }
+      }
+    }
+#endif
+
+    s21_vector<block_header> blocks_;
+    s21_vector<std::uint64_t> words_;  // the packed entries of every block, then one spare zero word
+    s21_vector<value_type> tail_;  // the last, partial block, not packed yet
+  };
+
+}
+
+#ifdef S21_SIMD_X86
+#undef S21_TARGET_AVX2
+#endif
+
+#endif  // SRC_S21_PACKED_INT_VECTOR_H_
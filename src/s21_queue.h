@@ -3,11 +3,17 @@
 
 // #include <iostream> // nah! 
 
+#include <new>
+
 namespace s21 {
 
+  struct serial_access;  // lets s21_serialize.h walk the nodes without copying the container
+
   template <typename T>
   class s21_queue 
   {
+    friend struct serial_access;
+
     using value_type = T; // T the template parameter T
     using reference = T &;  // defines the type of the reference to an element
     using const_reference = const T &;  // defines the type of the constant reference
@@ -109,7 +115,7 @@ namespace s21 {
         tail_->prev_ = nullptr;        
       }
       
-      new_node->data_ = reinterpret_cast<value_type*>(operator new(sizeof(value_type)));
+      new_node->data_ = static_cast<value_type*>(::operator new(sizeof(value_type), std::align_val_t(alignof(value_type))));  // honours over-aligned T
       try {
         new (new_node->data_) T(value);  // placement new
         ++size_;  
@@ -122,7 +128,7 @@ namespace s21 {
     {
       if (head_) {
         head_->data_->~T();
-        delete reinterpret_cast<int8_t*>(head_->data_);
+        ::operator delete(head_->data_, std::align_val_t(alignof(value_type)));
         if (tail_ != head_) {
           Node *tmp = head_;
           head_ = head_->prev_;
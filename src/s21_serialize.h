@@ -0,0 +1,725 @@
+#ifndef SRC_S21_SERIALIZE_H_
+#define SRC_S21_SERIALIZE_H_
+
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "s21_list.h"
+#include "s21_map.h"
+#include "s21_queue.h"
+#include "s21_set.h"
+#include "s21_stack.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // Binary serialization of the s21 containers for passing them between processes
+  // of the same build (Linux only). A record is a 32-byte header followed by the
+  // payload, in native byte order and layout:
+  //  * s21_vector<T> of a trivially copyable T: the payload is the buffer itself.
+  //    serialize() hands the header and data() to one writev(), deserialize() reads
+  //    straight into the vector's storage, and serial_view<T> reads it in place
+  //    from memory without copying anything.
+  //  * anything else: the payload is the elements one after another in iteration
+  //    order, each written by serial_traits<T>. It is staged in memory and moved
+  //    with one write()/read() as well; trivially copyable elements are raw bytes.
+  // Malformed or truncated input throws runtime_error, a failed read or write
+  // throws system_error; the target container is left empty in both cases.
+
+  enum class serial_kind : std::uint8_t {
+    vector = 1,
+    set,
+    map,
+    list,
+    stack,
+    queue
+  };
+
+  enum class serial_encoding : std::uint8_t {
+    raw = 1,     // payload is count * element_size bytes copied from one contiguous buffer
+    elements     // payload is count elements encoded one by one
+  };
+
+  // Coarse type of the elements, so that an int record is not read back as float
+  enum class serial_class : std::uint8_t {
+    other,
+    signed_integer,
+    unsigned_integer,
+    floating_point
+  };
+
+  struct serial_header {
+    char magic[4];
+    std::uint8_t version;
+    serial_kind kind;
+    serial_encoding encoding;
+    serial_class element_class;
+    std::uint32_t element_size;
+    std::uint32_t element_align;
+    std::uint64_t count;         // number of elements
+    std::uint64_t payload_size;  // bytes after the header
+  };
+
+  static_assert(sizeof(serial_header) == 32, "serial_header: the header is part of the format");
+
+  // Cursor over serialized bytes, handed to serial_traits<T>::read
+  class serial_reader
+  {
+  public:
+    serial_reader(const void *data, std::size_t size) noexcept
+      : position_(static_cast<const unsigned char*>(data)), end_(position_ + size) {}
+
+    const unsigned char *take(std::size_t n)  // returns the next n bytes and skips them
+    {
+      if (n > remaining()) {
+        throw std::runtime_error("serialize: truncated input");
+      }
+      const unsigned char *bytes = position_;
+      position_ += n;
+      return bytes;
+    }
+
+    void read(void *dest, std::size_t n)  // copies the next n bytes to dest
+    {
+      if (n) {
+        std::memcpy(dest, take(n), n);
+      }
+    }
+
+    const unsigned char *position() const noexcept  // the next unread byte
+    {
+      return position_;
+    }
+
+    std::size_t remaining() const noexcept
+    {
+      return static_cast<std::size_t>(end_ - position_);
+    }
+
+  private:
+    const unsigned char *position_;
+    const unsigned char *end_;
+  };
+
+  using serial_buffer = s21_vector<unsigned char>;
+
+  // How one element is written to and read back from an element-wise payload.
+  // Specialize it with write(serial_buffer &, const T &) and T read(serial_reader &)
+  // for element types other than the ones below; write() has to append at least
+  // one byte, since a record may not claim more elements than its payload has bytes.
+  template <typename T, typename = void>
+  struct serial_traits;
+
+  template <typename Container>
+  struct serial_codec;  // how a container is walked and rebuilt, defined below for each s21 container
+
+  namespace detail {
+
+    inline void append_bytes(serial_buffer &out, const void *bytes, std::size_t n)
+    {
+      std::size_t old_size = out.size();
+      out.resize_default_init(old_size + n);
+      if (n) {
+        std::memcpy(out.data() + old_size, bytes, n);
+      }
+    }
+
+    // the raw layout only exists for contiguous buffers of trivially copyable elements
+    template <typename Container>
+    constexpr bool raw_serializable() noexcept
+    {
+      return serial_codec<Container>::contiguous && std::is_trivially_copyable<typename serial_codec<Container>::element_type>::value;
+    }
+
+    template <typename T>
+    constexpr serial_class class_of() noexcept
+    {
+      if (std::is_floating_point<T>::value) {
+        return serial_class::floating_point;
+      }
+      if (std::is_integral<T>::value) {
+        return std::is_signed<T>::value ? serial_class::signed_integer : serial_class::unsigned_integer;
+      }
+      return serial_class::other;
+    }
+
+    template <typename Container>
+    serial_header make_header(const Container &c, serial_encoding encoding, std::size_t payload_size) noexcept
+    {
+      using element_type = typename serial_codec<Container>::element_type;
+      serial_header header{};
+      std::memcpy(header.magic, "s21s", 4);
+      header.version = 1;
+      header.kind = serial_codec<Container>::kind;
+      header.encoding = encoding;
+      header.element_class = class_of<element_type>();
+      header.element_size = static_cast<std::uint32_t>(sizeof(element_type));
+      header.element_align = static_cast<std::uint32_t>(alignof(element_type));
+      header.count = serial_codec<Container>::size(c);
+      header.payload_size = payload_size;
+      return header;
+    }
+
+    template <typename Container>
+    void check_header(const serial_header &header)
+    {
+      using element_type = typename serial_codec<Container>::element_type;
+      if (std::memcmp(header.magic, "s21s", 4) != 0 || header.version != 1) {
+        throw std::runtime_error("serialize: not a serialized s21 container");
+      }
+      if (header.kind != serial_codec<Container>::kind) {
+        throw std::runtime_error("serialize: the record holds another kind of container");
+      }
+      if (header.element_class != class_of<element_type>() || header.element_size != sizeof(element_type) ||
+          header.element_align != alignof(element_type)) {
+        throw std::runtime_error("serialize: the record was written for another element type");
+      }
+      if (header.encoding == serial_encoding::raw) {
+        if (!raw_serializable<Container>() || header.payload_size / sizeof(element_type) != header.count ||
+            header.payload_size % sizeof(element_type) != 0) {
+          throw std::runtime_error("serialize: malformed raw payload");
+        }
+      } else if (header.encoding != serial_encoding::elements) {
+          throw std::runtime_error("serialize: unknown encoding");
+      } else if (header.count > header.payload_size) {  // every element takes at least one byte
+          throw std::runtime_error("serialize: malformed payload");
+      }
+    }
+
+    // refuses a payload no buffer could hold, or longer than what is left of a
+    // regular file, before anything is allocated for it
+    inline void check_payload_size(int fd, const serial_header &header)
+    {
+      if (header.payload_size > serial_buffer().max_size()) {
+        throw std::runtime_error("serialize: payload too large");
+      }
+      struct stat status;
+      if (::fstat(fd, &status) == 0 && S_ISREG(status.st_mode)) {
+        off_t position = ::lseek(fd, 0, SEEK_CUR);
+        if (position >= 0 && (position > status.st_size ||
+                              header.payload_size > static_cast<std::uint64_t>(status.st_size - position))) {
+          throw std::runtime_error("serialize: truncated input");
+        }
+      }
+    }
+
+    template <typename Container>
+    void encode_elements(const Container &c, serial_buffer &out)
+    {
+      using element_type = typename serial_codec<Container>::element_type;
+      if (std::is_trivially_copyable<element_type>::value) {
+        out.reserve(out.size() + serial_codec<Container>::size(c) * sizeof(element_type));
+      }
+      serial_codec<Container>::for_each(c, [&out](const element_type &value) { serial_traits<element_type>::write(out, value); });
+    }
+
+    // rebuilds c from a payload; c is empty on entry and left empty if the payload is bad
+    template <typename Container>
+    void decode_payload(const serial_header &header, const unsigned char *payload, Container &c)
+    {
+      using element_type = typename serial_codec<Container>::element_type;
+      serial_reader in(payload, static_cast<std::size_t>(header.payload_size));
+      try {
+        if (header.encoding == serial_encoding::raw) {
+          if constexpr (raw_serializable<Container>()) {  // check_header() refuses raw records for anything else
+            serial_codec<Container>::assign_raw(c, static_cast<std::size_t>(header.count), [&in](element_type *dest, std::size_t n) {
+              in.read(dest, n * sizeof(element_type));
+            });
+          }
+        } else {
+            serial_codec<Container>::rebuild(c, static_cast<std::size_t>(header.count), [&in]() {
+              return serial_traits<element_type>::read(in);
+            });
+            if (in.remaining()) {
+              throw std::runtime_error("serialize: trailing bytes after the last element");
+            }
+        }
+      } catch (...) {
+          serial_codec<Container>::clear(c);
+          throw;
+      }
+    }
+
+    inline void write_all(int fd, iovec *parts, int count)  // writev() until every part is out
+    {
+      while (count) {
+        ssize_t written = ::writev(fd, parts, count);
+        if (written < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          throw std::system_error(errno, std::generic_category(), "serialize: write failed");
+        }
+        std::size_t left = static_cast<std::size_t>(written);
+        while (count && left >= parts->iov_len) {
+          left -= parts->iov_len;
+          ++parts;
+          --count;
+        }
+        if (count) {
+          parts->iov_base = static_cast<char*>(parts->iov_base) + left;
+          parts->iov_len -= left;
+        }
+      }
+    }
+
+    inline void read_all(int fd, void *dest, std::size_t n)  // read() until n bytes are in
+    {
+      char *position = static_cast<char*>(dest);
+      while (n) {
+        ssize_t got = ::read(fd, position, n);
+        if (got < 0) {
+          if (errno == EINTR) {
+            continue;
+          }
+          throw std::system_error(errno, std::generic_category(), "serialize: read failed");
+        }
+        if (got == 0) {
+          throw std::runtime_error("serialize: truncated input");
+        }
+        position += got;
+        n -= static_cast<std::size_t>(got);
+      }
+    }
+
+  }  // namespace detail
+
+// Element encodings ============================================================================
+
+  template <typename T>
+  struct serial_traits<T, std::enable_if_t<std::is_trivially_copyable<T>::value>> {
+    static void write(serial_buffer &out, const T &value)
+    {
+      detail::append_bytes(out, &value, sizeof(T));
+    }
+
+    static T read(serial_reader &in)
+    {
+      T value;
+      in.read(&value, sizeof(T));
+      return value;
+    }
+  };
+
+  template <typename Char, typename Traits, typename Allocator>
+  struct serial_traits<std::basic_string<Char, Traits, Allocator>> {  // length, then the characters
+    using string_type = std::basic_string<Char, Traits, Allocator>;
+
+    static void write(serial_buffer &out, const string_type &value)
+    {
+      std::uint64_t length = value.size();
+      detail::append_bytes(out, &length, sizeof(length));
+      detail::append_bytes(out, value.data(), value.size() * sizeof(Char));
+    }
+
+    static string_type read(serial_reader &in)
+    {
+      std::uint64_t length = serial_traits<std::uint64_t>::read(in);
+      if (length > in.remaining() / sizeof(Char)) {
+        throw std::runtime_error("serialize: truncated input");
+      }
+      string_type value(static_cast<std::size_t>(length), Char());
+      in.read(&value[0], value.size() * sizeof(Char));
+      return value;
+    }
+  };
+
+  template <typename First, typename Second>
+  struct serial_traits<std::pair<First, Second>, std::enable_if_t<!std::is_trivially_copyable<std::pair<First, Second>>::value>> {
+    static void write(serial_buffer &out, const std::pair<First, Second> &value)
+    {
+      serial_traits<First>::write(out, value.first);
+      serial_traits<Second>::write(out, value.second);
+    }
+
+    static std::pair<First, Second> read(serial_reader &in)
+    {
+      First first = serial_traits<First>::read(in);
+      return std::pair<First, Second>(std::move(first), serial_traits<Second>::read(in));
+    }
+  };
+
+  template <typename Container>
+  struct serial_traits<Container, std::void_t<decltype(serial_codec<Container>::kind)>> {  // nested containers are whole records
+    static void write(serial_buffer &out, const Container &value);
+    static Container read(serial_reader &in);
+  };
+
+// Containers ===================================================================================
+
+  // Gives the codecs of s21_stack and s21_queue access to their nodes
+  struct serial_access {
+    template <typename T, typename F>
+    static void for_each(const s21_stack<T> &s, F f)  // top first
+    {
+      for (auto *node = s.top_; node; node = node->next_) {
+        f(*node->data_);
+      }
+    }
+
+    template <typename T, typename F>
+    static void for_each(const s21_queue<T> &q, F f)  // front first
+    {
+      for (auto *node = q.head_; node; node = node->prev_) {
+        f(*node->data_);
+      }
+    }
+  };
+
+  template <typename T, typename Allocator, typename GrowthPolicy>
+  struct serial_codec<s21_vector<T, Allocator, GrowthPolicy>> {
+    using container_type = s21_vector<T, Allocator, GrowthPolicy>;
+    using element_type = T;
+
+    static constexpr serial_kind kind = serial_kind::vector;
+    static constexpr bool contiguous = !std::is_same<T, bool>::value;  // the bit-packed vector has no T buffer
+
+    static std::size_t size(const container_type &v) noexcept { return v.size(); }
+
+    template <typename F>
+    static void for_each(const container_type &v, F f)
+    {
+      for (auto it = v.cbegin(); it != v.cend(); ++it) {
+        f(*it);
+      }
+    }
+
+    template <typename Read>
+    static void assign_raw(container_type &v, std::size_t n, Read read)  // reads straight into the vector's buffer
+    {
+      v.resize_and_overwrite(n, [&read](T *dest, std::size_t count) {
+        read(dest, count);
+        return count;
+      });
+    }
+
+    template <typename Next>
+    static void rebuild(container_type &v, std::size_t n, Next next)
+    {
+      v.reserve(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        v.push_back(next());
+      }
+    }
+
+    static void clear(container_type &v) noexcept { v.clear(); }
+  };
+
+  template <typename Key>
+  struct serial_codec<Set<Key>> {
+    using element_type = Key;
+
+    static constexpr serial_kind kind = serial_kind::set;
+    static constexpr bool contiguous = false;
+
+    static std::size_t size(const Set<Key> &s) noexcept { return s.size(); }
+
+    template <typename F>
+    static void for_each(const Set<Key> &s, F f)
+    {
+      for (auto it = s.begin(); it != s.end(); ++it) {
+        f(*it);
+      }
+    }
+
+    template <typename Next>
+    static void rebuild(Set<Key> &s, std::size_t n, Next next)
+    {
+      for (std::size_t i = 0; i < n; ++i) {
+        s.insert(next());
+      }
+    }
+
+    static void clear(Set<Key> &s) { s.clear(); }
+  };
+
+  template <typename Key, typename T>
+  struct serial_codec<Map<Key, T>> {
+    using element_type = std::pair<Key, T>;
+
+    static constexpr serial_kind kind = serial_kind::map;
+    static constexpr bool contiguous = false;
+
+    static std::size_t size(const Map<Key, T> &m) noexcept { return m.size(); }
+
+    template <typename F>
+    static void for_each(const Map<Key, T> &m, F f)
+    {
+      for (auto it = m.begin(); it != m.end(); ++it) {
+        f(*it);
+      }
+    }
+
+    template <typename Next>
+    static void rebuild(Map<Key, T> &m, std::size_t n, Next next)
+    {
+      for (std::size_t i = 0; i < n; ++i) {
+        m.insert(next());
+      }
+    }
+
+    static void clear(Map<Key, T> &m) { m.clear(); }
+  };
+
+  template <typename T>
+  struct serial_codec<list<T>> {
+    using element_type = T;
+
+    static constexpr serial_kind kind = serial_kind::list;
+    static constexpr bool contiguous = false;
+
+    static std::size_t size(const list<T> &l) noexcept { return l.size(); }
+
+    template <typename F>
+    static void for_each(const list<T> &l, F f)
+    {
+      for (const T &value : l) {
+        f(value);
+      }
+    }
+
+    template <typename Next>
+    static void rebuild(list<T> &l, std::size_t n, Next next)
+    {
+      for (std::size_t i = 0; i < n; ++i) {
+        l.push_back(next());
+      }
+    }
+
+    static void clear(list<T> &l) { l.clear(); }
+  };
+
+  template <typename T>
+  struct serial_codec<s21_stack<T>> {
+    using element_type = T;
+
+    static constexpr serial_kind kind = serial_kind::stack;
+    static constexpr bool contiguous = false;
+
+    static std::size_t size(const s21_stack<T> &s) noexcept { return s.size(); }
+
+    template <typename F>
+    static void for_each(const s21_stack<T> &s, F f)  // top first
+    {
+      serial_access::for_each(s, f);
+    }
+
+    template <typename Next>
+    static void rebuild(s21_stack<T> &s, std::size_t n, Next next)  // the elements come top first, so they are pushed in reverse
+    {
+      s21_vector<T> elements;
+      elements.reserve(n);
+      for (std::size_t i = 0; i < n; ++i) {
+        elements.push_back(next());
+      }
+      for (std::size_t i = n; i > 0; --i) {
+        s.push(elements[i - 1]);
+      }
+    }
+
+    static void clear(s21_stack<T> &s) noexcept
+    {
+      while (!s.empty()) {
+        s.pop();
+      }
+    }
+  };
+
+  template <typename T>
+  struct serial_codec<s21_queue<T>> {
+    using element_type = T;
+
+    static constexpr serial_kind kind = serial_kind::queue;
+    static constexpr bool contiguous = false;
+
+    static std::size_t size(const s21_queue<T> &q) noexcept { return q.size(); }
+
+    template <typename F>
+    static void for_each(const s21_queue<T> &q, F f)  // front first
+    {
+      serial_access::for_each(q, f);
+    }
+
+    template <typename Next>
+    static void rebuild(s21_queue<T> &q, std::size_t n, Next next)
+    {
+      for (std::size_t i = 0; i < n; ++i) {
+        q.push(next());
+      }
+    }
+
+    static void clear(s21_queue<T> &q) noexcept
+    {
+      while (!q.empty()) {
+        q.pop();
+      }
+    }
+  };
+
+// Memory =======================================================================================
+
+  template <typename Container>
+  void serialize(const Container &c, serial_buffer &out)  // appends the record of c to out
+  {
+    using element_type = typename serial_codec<Container>::element_type;
+    std::size_t header_at = out.size();
+    out.resize_default_init(header_at + sizeof(serial_header));
+    serial_header header;
+    if constexpr (detail::raw_serializable<Container>()) {
+      header = detail::make_header(c, serial_encoding::raw, c.size() * sizeof(element_type));
+      detail::append_bytes(out, c.data(), c.size() * sizeof(element_type));
+    } else {
+        detail::encode_elements(c, out);
+        header = detail::make_header(c, serial_encoding::elements, out.size() - header_at - sizeof(serial_header));
+    }
+    std::memcpy(out.data() + header_at, &header, sizeof(header));
+  }
+
+  // Replaces the contents of c with the record at the start of [data, data + size)
+  // and returns the size of that record, so records written back to back can be
+  // read one after another.
+  template <typename Container>
+  std::size_t deserialize(const void *data, std::size_t size, Container &c)
+  {
+    serial_codec<Container>::clear(c);
+    serial_reader in(data, size);
+    serial_header header;
+    in.read(&header, sizeof(header));
+    detail::check_header<Container>(header);
+    detail::decode_payload(header, in.take(static_cast<std::size_t>(header.payload_size)), c);
+    return sizeof(header) + static_cast<std::size_t>(header.payload_size);
+  }
+
+  // Read-only view of a serialized s21_vector<T> of trivially copyable elements,
+  // pointing into the buffer it was made from: nothing is copied. The buffer has
+  // to outlive the view and be aligned for T (anything from malloc or mmap is).
+  template <typename T>
+  class serial_view
+  {
+    static_assert(std::is_trivially_copyable<T>::value && !std::is_same<T, bool>::value, "serial_view: only raw vector records can be viewed in place");
+    static_assert(alignof(T) <= sizeof(serial_header), "serial_view: elements would not be aligned after the header");
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using const_reference = const T &;
+    using const_iterator = const T *;
+
+    serial_view() noexcept : array_(nullptr), size_array_(0) {}
+
+    serial_view(const void *data, std::size_t size) : serial_view()  // views the record at the start of data
+    {
+      serial_reader in(data, size);
+      serial_header header;
+      in.read(&header, sizeof(header));
+      detail::check_header<s21_vector<T>>(header);
+      if (header.encoding != serial_encoding::raw) {
+        throw std::runtime_error("serial_view: the record is not a raw vector");
+      }
+      const unsigned char *payload = in.take(static_cast<std::size_t>(header.payload_size));
+      if (reinterpret_cast<std::uintptr_t>(payload) % alignof(T) != 0) {
+        throw std::runtime_error("serial_view: the buffer is not aligned for the elements");
+      }
+      array_ = reinterpret_cast<const T*>(payload);
+      size_array_ = static_cast<size_type>(header.count);
+    }
+
+    bool empty() const noexcept { return size_array_ == 0; }
+    size_type size() const noexcept { return size_array_; }
+    const T *data() const noexcept { return array_; }
+
+    const_reference operator[](size_type pos) const noexcept { return array_[pos]; }
+
+    const_reference at(size_type pos) const
+    {
+      if (pos >= size_array_) {
+        throw std::out_of_range("serial_view::at: index out of range");
+      }
+      return array_[pos];
+    }
+
+    const_iterator begin() const noexcept { return array_; }
+    const_iterator end() const noexcept { return array_ + size_array_; }
+
+  private:
+    const T *array_;
+    size_type size_array_;
+  };
+
+// File descriptors =============================================================================
+
+  template <typename Container>
+  void serialize(int fd, const Container &c)  // writes the record of c to fd in a single writev()
+  {
+    using element_type = typename serial_codec<Container>::element_type;
+    if constexpr (detail::raw_serializable<Container>()) {
+      serial_header header = detail::make_header(c, serial_encoding::raw, c.size() * sizeof(element_type));
+      iovec parts[2] = {{&header, sizeof(header)}, {const_cast<element_type*>(c.data()), c.size() * sizeof(element_type)}};
+      detail::write_all(fd, parts, 2);
+    } else {
+        serial_buffer payload;
+        detail::encode_elements(c, payload);
+        serial_header header = detail::make_header(c, serial_encoding::elements, payload.size());
+        iovec parts[2] = {{&header, sizeof(header)}, {payload.data(), payload.size()}};
+        detail::write_all(fd, parts, 2);
+    }
+  }
+
+  // Replaces the contents of c with the next record on fd. Exactly one record is
+  // consumed, so it works on pipes and sockets as well as files.
+  template <typename Container>
+  void deserialize(int fd, Container &c)
+  {
+    using element_type = typename serial_codec<Container>::element_type;
+    serial_codec<Container>::clear(c);
+    serial_header header;
+    detail::read_all(fd, &header, sizeof(header));
+    detail::check_header<Container>(header);
+    detail::check_payload_size(fd, header);
+    if (header.encoding == serial_encoding::raw) {
+      if constexpr (detail::raw_serializable<Container>()) {
+        try {
+          serial_codec<Container>::assign_raw(c, static_cast<std::size_t>(header.count), [fd](element_type *dest, std::size_t n) {
+            detail::read_all(fd, dest, n * sizeof(element_type));
+          });
+        } catch (...) {
+            serial_codec<Container>::clear(c);
+            throw;
+        }
+      }
+    } else {
+        serial_buffer payload;
+        payload.resize_and_overwrite(static_cast<std::size_t>(header.payload_size), [fd](unsigned char *dest, std::size_t n) {
+          detail::read_all(fd, dest, n);
+          return n;
+        });
+        detail::decode_payload(header, payload.data(), c);
+    }
+  }
+
+  template <typename Container>
+  void serial_traits<Container, std::void_t<decltype(serial_codec<Container>::kind)>>::write(serial_buffer &out, const Container &value)
+  {
+    serialize(value, out);
+  }
+
+  template <typename Container>
+  Container serial_traits<Container, std::void_t<decltype(serial_codec<Container>::kind)>>::read(serial_reader &in)
+  {
+    Container value;
+    in.take(deserialize(in.position(), in.remaining(), value));
+    return value;
+  }
+
+}
+
+#endif  // SRC_S21_SERIALIZE_H_
@@ -1,3 +1,6 @@
+#ifndef SRC_S21_SET_H_
+#define SRC_S21_SET_H_
+
 #ifndef GRANDFATHER_H
 #define GRANDFATHER_H
 #include "rbtree.h"
@@ -72,4 +75,6 @@ namespace s21
     private:
         tree tree_;
     };
-}
\ No newline at end of file
+}
+
+#endif  // SRC_S21_SET_H_
@@ -0,0 +1,690 @@
+#ifndef SRC_S21_SIMD_H_
+#define SRC_S21_SIMD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define S21_SIMD_X86 1
+#define S21_TARGET_AVX2 __attribute__((target("avx2,popcnt")))
+#define S21_TARGET_SSE42 __attribute__((target("sse4.2,popcnt")))
+#endif
+
+// Search and reduction kernels over contiguous arithmetic data. For 32 and 64 bit
+// integers, float and double the work is done with AVX2 or SSE4.2, whichever the
+// CPU running the program supports (checked once, at the first call); every other
+// element type, other CPUs and the tails of the ranges use the scalar loops.
+namespace s21 {
+namespace simd {
+
+  // sum() accumulates integers in 64 bits (wrapping like unsigned arithmetic) and
+  // floating point in the element type; lanes change the order of float additions
+  template <typename T>
+  using sum_t = std::conditional_t<std::is_floating_point<T>::value, T,
+                                   std::conditional_t<std::is_signed<T>::value, std::int64_t, std::uint64_t>>;
+
+  namespace scalar {
+
+    template <typename T>
+    const T *find(const T *first, const T *last, T value) noexcept  // first element equal to value, or last
+    {
+      for (; first != last; ++first) {
+        if (*first == value) {
+          return first;
+        }
+      }
+      return last;
+    }
+
+    template <typename T>
+    std::size_t count(const T *first, const T *last, T value) noexcept  // number of elements equal to value
+    {
+      std::size_t n = 0;
+      for (; first != last; ++first) {
+        n += *first == value;
+      }
+      return n;
+    }
+
+    template <typename T>
+    std::pair<T, T> minmax(const T *first, const T *last) noexcept  // smallest and largest element of a non-empty range
+    {
+      std::pair<T, T> result(*first, *first);
+      for (++first; first != last; ++first) {
+        if (*first < result.first) {
+          result.first = *first;
+        }
+        if (result.second < *first) {
+          result.second = *first;
+        }
+      }
+      return result;
+    }
+
+    template <typename T>
+    sum_t<T> sum(const T *first, const T *last) noexcept
+    {
+      sum_t<T> total = 0;
+      for (; first != last; ++first) {
+        total += static_cast<sum_t<T>>(*first);
+      }
+      return total;
+    }
+
+    template <typename T>
+    bool contains_any(const T *first, const T *last, const T *values, std::size_t n) noexcept  // does any element equal any of the n values
+    {
+      for (; first != last; ++first) {
+        for (std::size_t j = 0; j != n; ++j) {
+          if (*first == values[j]) {
+            return true;
+          }
+        }
+      }
+      return false;
+    }
+
+  }  // namespace scalar
+
+  namespace detail {
+
+    template <typename T>
+    constexpr bool vectorized =
+        std::is_same<T, std::int32_t>::value || std::is_same<T, std::uint32_t>::value ||
+        std::is_same<T, std::int64_t>::value || std::is_same<T, std::uint64_t>::value ||
+        std::is_same<T, float>::value || std::is_same<T, double>::value;
+
+    enum class isa { scalar, sse42, avx2 };
+
+    inline isa detect_isa() noexcept
+    {
+#ifdef S21_SIMD_X86
+      __builtin_cpu_init();
+      if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt")) {
+        return isa::avx2;
+      }
+      if (__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt")) {
+        return isa::sse42;
+      }
+#endif
+      return isa::scalar;
+    }
+
+    inline isa active_isa() noexcept
+    {
+      static const isa level = detect_isa();
+      return level;
+    }
+
+#ifdef S21_SIMD_X86
+
+    // Per element type and instruction set: load/set1/store, eq() as a bit per lane,
+    // lane-wise min/max, and a 64-bit (or floating) accumulator for sum()
+    template <typename T>
+    struct avx2_ops;
+
+    template <typename T>
+    struct sse42_ops;
+
+    template <>
+    struct avx2_ops<std::int32_t>
+    {
+      using T = std::int32_t;
+      using vec = __m256i;
+      using acc = __m256i;
+      static constexpr std::size_t lanes = 8;
+      static constexpr std::size_t sum_lanes = 4;
+      S21_TARGET_AVX2 static vec load(const T *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+      S21_TARGET_AVX2 static vec set1(T v) { return _mm256_set1_epi32(v); }
+      S21_TARGET_AVX2 static void store(T *p, vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+      S21_TARGET_AVX2 static unsigned eq(vec a, vec b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+      S21_TARGET_AVX2 static vec min(vec a, vec b) { return _mm256_min_epi32(a, b); }
+      S21_TARGET_AVX2 static vec max(vec a, vec b) { return _mm256_max_epi32(a, b); }
+      S21_TARGET_AVX2 static acc sum_zero() { return _mm256_setzero_si256(); }
+      S21_TARGET_AVX2 static acc sum_add(acc s, const T *p) { return _mm256_add_epi64(s, _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)))); }
+      S21_TARGET_AVX2 static sum_t<T> sum_reduce(acc s)
+      {
+        alignas(32) std::int64_t lane[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lane), s);
+        return lane[0] + lane[1] + lane[2] + lane[3];
+      }
+    };
+
+    template <>
+    struct avx2_ops<std::uint32_t>
+    {
+      using T = std::uint32_t;
+      using vec = __m256i;
+      using acc = __m256i;
+      static constexpr std::size_t lanes = 8;
+      static constexpr std::size_t sum_lanes = 4;
+      S21_TARGET_AVX2 static vec load(const T *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+      S21_TARGET_AVX2 static vec set1(T v) { return _mm256_set1_epi32(static_cast<int>(v)); }
+      S21_TARGET_AVX2 static void store(T *p, vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+      S21_TARGET_AVX2 static unsigned eq(vec a, vec b) { return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+      S21_TARGET_AVX2 static vec min(vec a, vec b) { return _mm256_min_epu32(a, b); }
+      S21_TARGET_AVX2 static vec max(vec a, vec b) { return _mm256_max_epu32(a, b); }
+      S21_TARGET_AVX2 static acc sum_zero() { return _mm256_setzero_si256(); }
+      S21_TARGET_AVX2 static acc sum_add(acc s, const T *p) { return _mm256_add_epi64(s, _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)))); }
+      S21_TARGET_AVX2 static sum_t<T> sum_reduce(acc s)
+      {
+        alignas(32) std::uint64_t lane[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lane), s);
+        return lane[0] + lane[1] + lane[2] + lane[3];
+      }
+    };
+
+    template <typename T, bool Unsigned>
+    struct avx2_ops64  // AVX2 has no 64-bit min/max: compare (with the sign bit flipped when unsigned) and blend
+    {
+      using vec = __m256i;
+      using acc = __m256i;
+      static constexpr std::size_t lanes = 4;
+      static constexpr std::size_t sum_lanes = 4;
+      S21_TARGET_AVX2 static vec load(const T *p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+      S21_TARGET_AVX2 static vec set1(T v) { return _mm256_set1_epi64x(static_cast<long long>(v)); }
+      S21_TARGET_AVX2 static void store(T *p, vec v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+      S21_TARGET_AVX2 static unsigned eq(vec a, vec b) { return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(a, b))); }
+      S21_TARGET_AVX2 static vec greater(vec a, vec b)
+      {
+        if (Unsigned) {
+          const vec bias = _mm256_set1_epi64x(INT64_MIN);
+          return _mm256_cmpgt_epi64(_mm256_xor_si256(a, bias), _mm256_xor_si256(b, bias));
+        }
+        return _mm256_cmpgt_epi64(a, b);
+      }
+      S21_TARGET_AVX2 static vec min(vec a, vec b) { return _mm256_blendv_epi8(a, b, greater(a, b)); }
+      S21_TARGET_AVX2 static vec max(vec a, vec b) { return _mm256_blendv_epi8(b, a, greater(a, b)); }
+      S21_TARGET_AVX2 static acc sum_zero() { return _mm256_setzero_si256(); }
+      S21_TARGET_AVX2 static acc sum_add(acc s, const T *p) { return _mm256_add_epi64(s, load(p)); }
+      S21_TARGET_AVX2 static sum_t<T> sum_reduce(acc s)
+      {
+        alignas(32) T lane[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lane), s);
+        return static_cast<sum_t<T>>(static_cast<std::uint64_t>(lane[0]) + lane[1] + lane[2] + lane[3]);
+      }
+    };
+
+    template <>
+    struct avx2_ops<std::int64_t> : avx2_ops64<std::int64_t, false> {};
+
+    template <>
+    struct avx2_ops<std::uint64_t> : avx2_ops64<std::uint64_t, true> {};
+
+    template <>
+    struct avx2_ops<float>
+    {
+      using T = float;
+      using vec = __m256;
+      using acc = __m256;
+      static constexpr std::size_t lanes = 8;
+      static constexpr std::size_t sum_lanes = 8;
+      S21_TARGET_AVX2 static vec load(const T *p) { return _mm256_loadu_ps(p); }
+      S21_TARGET_AVX2 static vec set1(T v) { return _mm256_set1_ps(v); }
+      S21_TARGET_AVX2 static void store(T *p, vec v) { _mm256_storeu_ps(p, v); }
+      S21_TARGET_AVX2 static unsigned eq(vec a, vec b) { return _mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+      S21_TARGET_AVX2 static vec min(vec a, vec b) { return _mm256_min_ps(a, b); }
+      S21_TARGET_AVX2 static vec max(vec a, vec b) { return _mm256_max_ps(a, b); }
+      S21_TARGET_AVX2 static acc sum_zero() { return _mm256_setzero_ps(); }
+      S21_TARGET_AVX2 static acc sum_add(acc s, const T *p) { return _mm256_add_ps(s, load(p)); }
+      S21_TARGET_AVX2 static sum_t<T> sum_reduce(acc s)
+      {
+        alignas(32) float lane[8];
+        _mm256_store_ps(lane, s);
+        return ((lane[0] + lane[1]) + (lane[2] + lane[3])) + ((lane[4] + lane[5]) + (lane[6] + lane[7]));
+      }
+    };
+
+    template <>
+    struct avx2_ops<double>
+    {
+      using T = double;
+      using vec = __m256d;
+      using acc = __m256d;
+      static constexpr std::size_t lanes = 4;
+      static constexpr std::size_t sum_lanes = 4;
+      S21_TARGET_AVX2 static vec load(const T *p) { return _mm256_loadu_pd(p); }
+      S21_TARGET_AVX2 static vec set1(T v) { return _mm256_set1_pd(v); }
+      S21_TARGET_AVX2 static void store(T *p, vec v) { _mm256_storeu_pd(p, v); }
+      S21_TARGET_AVX2 static unsigned eq(vec a, vec b) { return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+      S21_TARGET_AVX2 static vec min(vec a, vec b) { return _mm256_min_pd(a, b); }
+      S21_TARGET_AVX2 static vec max(vec a, vec b) { return _mm256_max_pd(a, b); }
+      S21_TARGET_AVX2 static acc sum_zero() { return _mm256_setzero_pd(); }
+      S21_TARGET_AVX2 static acc sum_add(acc s, const T *p) { return _mm256_add_pd(s, load(p)); }
+      S21_TARGET_AVX2 static sum_t<T> sum_reduce(acc s)
+      {
+        alignas(32) double lane[4];
+        _mm256_store_pd(lane, s);
+        return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+      }
+    };
+
+    template <>
+    struct sse42_ops<std::int32_t>
+    {
+      using T = std::int32_t;
+      using vec = __m128i;
+      using acc = __m128i;
+      static constexpr std::size_t lanes = 4;
+      static constexpr std::size_t sum_lanes = 2;
+      S21_TARGET_SSE42 static vec load(const T *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+      S21_TARGET_SSE42 static vec set1(T v) { return _mm_set1_epi32(v); }
+      S21_TARGET_SSE42 static void store(T *p, vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+      S21_TARGET_SSE42 static unsigned eq(vec a, vec b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+      S21_TARGET_SSE42 static vec min(vec a, vec b) { return _mm_min_epi32(a, b); }
+      S21_TARGET_SSE42 static vec max(vec a, vec b) { return _mm_max_epi32(a, b); }
+      S21_TARGET_SSE42 static acc sum_zero() { return _mm_setzero_si128(); }
+      S21_TARGET_SSE42 static acc sum_add(acc s, const T *p) { return _mm_add_epi64(s, _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)))); }
+      S21_TARGET_SSE42 static sum_t<T> sum_reduce(acc s)
+      {
+        alignas(16) std::int64_t lane[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lane), s);
+        return lane[0] + lane[1];
+      }
+    };
+
+    template <>
+    struct sse42_ops<std::uint32_t>
+    {
+      using T = std::uint32_t;
+      using vec = __m128i;
+      using acc = __m128i;
+      static constexpr std::size_t lanes = 4;
+      static constexpr std::size_t sum_lanes = 2;
+      S21_TARGET_SSE42 static vec load(const T *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+      S21_TARGET_SSE42 static vec set1(T v) { return _mm_set1_epi32(static_cast<int>(v)); }
+      S21_TARGET_SSE42 static void store(T *p, vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+      S21_TARGET_SSE42 static unsigned eq(vec a, vec b) { return _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+      S21_TARGET_SSE42 static vec min(vec a, vec b) { return _mm_min_epu32(a, b); }
+      S21_TARGET_SSE42 static vec max(vec a, vec b) { return _mm_max_epu32(a, b); }
+      S21_TARGET_SSE42 static acc sum_zero() { return _mm_setzero_si128(); }
+      S21_TARGET_SSE42 static acc sum_add(acc s, const T *p) { return _mm_add_epi64(s, _mm_cvtepu32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p)))); }
+      S21_TARGET_SSE42 static sum_t<T> sum_reduce(acc s)
+      {
+        alignas(16) std::uint64_t lane[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lane), s);
+        return lane[0] + lane[1];
+      }
+    };
+
+    template <typename T, bool Unsigned>
+    struct sse42_ops64  // pcmpgtq is the SSE4.2 instruction; min/max are compare and blend
+    {
+      using vec = __m128i;
+      using acc = __m128i;
+      static constexpr std::size_t lanes = 2;
+      static constexpr std::size_t sum_lanes = 2;
+      S21_TARGET_SSE42 static vec load(const T *p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+      S21_TARGET_SSE42 static vec set1(T v) { return _mm_set1_epi64x(static_cast<long long>(v)); }
+      S21_TARGET_SSE42 static void store(T *p, vec v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+      S21_TARGET_SSE42 static unsigned eq(vec a, vec b) { return _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(a, b))); }
+      S21_TARGET_SSE42 static vec greater(vec a, vec b)
+      {
+        if (Unsigned) {
+          const vec bias = _mm_set1_epi64x(INT64_MIN);
+          return _mm_cmpgt_epi64(_mm_xor_si128(a, bias), _mm_xor_si128(b, bias));
+        }
+        return _mm_cmpgt_epi64(a, b);
+      }
+      S21_TARGET_SSE42 static vec min(vec a, vec b) { return _mm_blendv_epi8(a, b, greater(a, b)); }
+      S21_TARGET_SSE42 static vec max(vec a, vec b) { return _mm_blendv_epi8(b, a, greater(a, b)); }
+      S21_TARGET_SSE42 static acc sum_zero() { return _mm_setzero_si128(); }
+      S21_TARGET_SSE42 static acc sum_add(acc s, const T *p) { return _mm_add_epi64(s, load(p)); }
+      S21_TARGET_SSE42 static sum_t<T> sum_reduce(acc s)
+      {
+        alignas(16) T lane[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lane), s);
+        return static_cast<sum_t<T>>(static_cast<std::uint64_t>(lane[0]) + lane[1]);
+      }
+    };
+
+    template <>
+    struct sse42_ops<std::int64_t> : sse42_ops64<std::int64_t, false> {};
+
+    template <>
+    struct sse42_ops<std::uint64_t> : sse42_ops64<std::uint64_t, true> {};
+
+    template <>
+    struct sse42_ops<float>
+    {
+      using T = float;
+      using vec = __m128;
+      using acc = __m128;
+      static constexpr std::size_t lanes = 4;
+      static constexpr std::size_t sum_lanes = 4;
+      S21_TARGET_SSE42 static vec load(const T *p) { return _mm_loadu_ps(p); }
+      S21_TARGET_SSE42 static vec set1(T v) { return _mm_set1_ps(v); }
+      S21_TARGET_SSE42 static void store(T *p, vec v) { _mm_storeu_ps(p, v); }
+      S21_TARGET_SSE42 static unsigned eq(vec a, vec b) { return _mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+      S21_TARGET_SSE42 static vec min(vec a, vec b) { return _mm_min_ps(a, b); }
+      S21_TARGET_SSE42 static vec max(vec a, vec b) { return _mm_max_ps(a, b); }
+      S21_TARGET_SSE42 static acc sum_zero() { return _mm_setzero_ps(); }
+      S21_TARGET_SSE42 static acc sum_add(acc s, const T *p) { return _mm_add_ps(s, load(p)); }
+      S21_TARGET_SSE42 static sum_t<T> sum_reduce(acc s)
+      {
+        alignas(16) float lane[4];
+        _mm_store_ps(lane, s);
+        return (lane[0] + lane[1]) + (lane[2] + lane[3]);
+      }
+    };
+
+    template <>
+    struct sse42_ops<double>
+    {
+      using T = double;
+      using vec = __m128d;
+      using acc = __m128d;
+      static constexpr std::size_t lanes = 2;
+      static constexpr std::size_t sum_lanes = 2;
+      S21_TARGET_SSE42 static vec load(const T *p) { return _mm_loadu_pd(p); }
+      S21_TARGET_SSE42 static vec set1(T v) { return _mm_set1_pd(v); }
+      S21_TARGET_SSE42 static void store(T *p, vec v) { _mm_storeu_pd(p, v); }
+      S21_TARGET_SSE42 static unsigned eq(vec a, vec b) { return _mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+      S21_TARGET_SSE42 static vec min(vec a, vec b) { return _mm_min_pd(a, b); }
+      S21_TARGET_SSE42 static vec max(vec a, vec b) { return _mm_max_pd(a, b); }
+      S21_TARGET_SSE42 static acc sum_zero() { return _mm_setzero_pd(); }
+      S21_TARGET_SSE42 static acc sum_add(acc s, const T *p) { return _mm_add_pd(s, load(p)); }
+      S21_TARGET_SSE42 static sum_t<T> sum_reduce(acc s)
+      {
+        alignas(16) double lane[2];
+        _mm_store_pd(lane, s);
+        return lane[0] + lane[1];
+      }
+    };
+
+    // The kernels are spelled out once per instruction set because the target
+    // attribute, which lets the ops above inline, cannot be a template argument.
+
+    template <typename T>
+    S21_TARGET_AVX2 const T *avx2_find(const T *first, const T *last, T value) noexcept
+    {
+      using ops = avx2_ops<T>;
+      const auto needle = ops::set1(value);
+      for (; std::size_t(last - first) >= ops::lanes; first += ops::lanes) {
+        if (unsigned mask = ops::eq(ops::load(first), needle)) {
+          return first + __builtin_ctz(mask);
+        }
+      }
+      return scalar::find(first, last, value);
+    }
+
+    template <typename T>
+    S21_TARGET_AVX2 std::size_t avx2_count(const T *first, const T *last, T value) noexcept
+    {
+      using ops = avx2_ops<T>;
+      const auto needle = ops::set1(value);
+      std::size_t n = 0;
+      for (; std::size_t(last - first) >= ops::lanes; first += ops::lanes) {
+        n += __builtin_popcount(ops::eq(ops::load(first), needle));
+      }
+      return n + scalar::count(first, last, value);
+    }
+
+    template <typename T>
+    S21_TARGET_AVX2 std::pair<T, T> avx2_minmax(const T *first, const T *last) noexcept
+    {
+      using ops = avx2_ops<T>;
+      if (std::size_t(last - first) < ops::lanes) {
+        return scalar::minmax(first, last);
+      }
+      auto lo = ops::load(first);
+      auto hi = lo;
+      for (first += ops::lanes; std::size_t(last - first) >= ops::lanes; first += ops::lanes) {
+        auto block = ops::load(first);
+        lo = ops::min(lo, block);
+        hi = ops::max(hi, block);
+      }
+      T lane[2 * ops::lanes];
+      ops::store(lane, lo);
+      ops::store(lane + ops::lanes, hi);
+      std::pair<T, T> result(scalar::minmax(lane, lane + ops::lanes).first,
+                             scalar::minmax(lane + ops::lanes, lane + 2 * ops::lanes).second);
+      if (first != last) {
+        std::pair<T, T> tail = scalar::minmax(first, last);
+        result.first = tail.first < result.first ? tail.first : result.first;
+        result.second = result.second < tail.second ? tail.second : result.second;
+      }
+      return result;
+    }
+
+    template <typename T>
+    S21_TARGET_AVX2 sum_t<T> avx2_sum(const T *first, const T *last) noexcept
+    {
+      using ops = avx2_ops<T>;
+      auto total = ops::sum_zero();
+      for (; std::size_t(last - first) >= ops::sum_lanes; first += ops::sum_lanes) {
+        total = ops::sum_add(total, first);
+      }
+      return static_cast<sum_t<T>>(ops::sum_reduce(total) + scalar::sum(first, last));
+    }
+
+    template <typename T>
+    S21_TARGET_AVX2 bool avx2_contains_any(const T *first, const T *last, const T *values, std::size_t n) noexcept
+    {
+      using ops = avx2_ops<T>;
+      for (; std::size_t(last - first) >= ops::lanes; first += ops::lanes) {
+        auto block = ops::load(first);
+        unsigned mask = 0;
+        for (std::size_t j = 0; j != n; ++j) {
+          mask |= ops::eq(block, ops::set1(values[j]));
+        }
+        if (mask) {
+          return true;
+        }
+      }
+      return scalar::contains_any(first, last, values, n);
+    }
+
+    template <typename T>
+    S21_TARGET_SSE42 const T *sse42_find(const T *first, const T *last, T value) noexcept
+    {
+      using ops = sse42_ops<T>;
+      const auto needle = ops::set1(value);
+      for (; std::size_t(last - first) >= ops::lanes; first += ops::lanes) {
+        if (unsigned mask = ops::eq(ops::load(first), needle)) {
+          return first + __builtin_ctz(mask);
+        }
+      }
+      return scalar::find(first, last, value);
+    }
+
+    template <typename T>
+    S21_TARGET_SSE42 std::size_t sse42_count(const T *first, const T *last, T value) noexcept
+    {
+      using ops = sse42_ops<T>;
+      const auto needle = ops::set1(value);
+      std::size_t n = 0;
+      for (; std::size_t(last - first) >= ops::lanes; first += ops::lanes) {
+        n += __builtin_popcount(ops::eq(ops::load(first), needle));
+      }
+      return n + scalar::count(first, last, value);
+    }
+
+    template <typename T>
+    S21_TARGET_SSE42 std::pair<T, T> sse42_minmax(const T *first, const T *last) noexcept
+    {
+      using ops = sse42_ops<T>;
+      if (std::size_t(last - first) < ops::lanes) {
+        return scalar::minmax(first, last);
+      }
+      auto lo = ops::load(first);
+      auto hi = lo;
+      for (first += ops::lanes; std::size_t(last - first) >= ops::lanes; first += ops::lanes) {
+        auto block = ops::load(first);
+        lo = ops::min(lo, block);
+        hi = ops::max(hi, block);
+      }
+      T lane[2 * ops::lanes];
+      ops::store(lane, lo);
+      ops::store(lane + ops::lanes, hi);
+      std::pair<T, T> result(scalar::minmax(lane, lane + ops::lanes).first,
+                             scalar::minmax(lane + ops::lanes, lane + 2 * ops::lanes).second);
+      if (first != last) {
+        std::pair<T, T> tail = scalar::minmax(first, last);
+        result.first = tail.first < result.first ? tail.first : result.first;
+        result.second = result.second < tail.second ? tail.second : result.second;
+      }
+      return result;
+    }
+
+    template <typename T>
+    S21_TARGET_SSE42 sum_t<T> sse42_sum(const T *first, const T *last) noexcept
+    {
+      using ops = sse42_ops<T>;
+      auto total = ops::sum_zero();
+      for (; std::size_t(last - first) >= ops::sum_lanes; first += ops::sum_lanes) {
+        total = ops::sum_add(total, first);
+      }
+      return static_cast<sum_t<T>>(ops::sum_reduce(total) + scalar::sum(first, last));
+    }
+
+    template <typename T>
+    S21_TARGET_SSE42 bool sse42_contains_any(const T *first, const T *last, const T *values, std::size_t n) noexcept
+    {
+      using ops = sse42_ops<T>;
+      for (; std::size_t(last - first) >= ops::lanes; first += ops::lanes) {
+        auto block = ops::load(first);
+        unsigned mask = 0;
+        for (std::size_t j = 0; j != n; ++j) {
+          mask |= ops::eq(block, ops::set1(values[j]));
+        }
+        if (mask) {
+          return true;
+        }
+      }
+      return scalar::contains_any(first, last, values, n);
+    }
+
+#endif  // S21_SIMD_X86
+
+  }  // namespace detail
+
+// Pointer ranges ===============================================================================
+
+  template <typename T>
+  const T *find(const T *first, const T *last, T value) noexcept  // first element equal to value, or last
+  {
+#ifdef S21_SIMD_X86
+    if constexpr (detail::vectorized<T>) {
+      switch (detail::active_isa()) {
+        case detail::isa::avx2: return detail::avx2_find(first, last, value);
+        case detail::isa::sse42: return detail::sse42_find(first, last, value);
+        default: break;
+      }
+    }
+#endif
+    return scalar::find(first, last, value);
+  }
+
+  template <typename T>
+  std::size_t count(const T *first, const T *last, T value) noexcept  // number of elements equal to value
+  {
+#ifdef S21_SIMD_X86
+    if constexpr (detail::vectorized<T>) {
+      switch (detail::active_isa()) {
+        case detail::isa::avx2: return detail::avx2_count(first, last, value);
+        case detail::isa::sse42: return detail::sse42_count(first, last, value);
+        default: break;
+      }
+    }
+#endif
+    return scalar::count(first, last, value);
+  }
+
+  // smallest and largest element of a non-empty range; with NaNs in the range the result is unspecified
+  template <typename T>
+  std::pair<T, T> minmax(const T *first, const T *last) noexcept
+  {
+#ifdef S21_SIMD_X86
+    if constexpr (detail::vectorized<T>) {
+      switch (detail::active_isa()) {
+        case detail::isa::avx2: return detail::avx2_minmax(first, last);
+        case detail::isa::sse42: return detail::sse42_minmax(first, last);
+        default: break;
+      }
+    }
+#endif
+    return scalar::minmax(first, last);
+  }
+
+  template <typename T>
+  sum_t<T> sum(const T *first, const T *last) noexcept
+  {
+#ifdef S21_SIMD_X86
+    if constexpr (detail::vectorized<T>) {
+      switch (detail::active_isa()) {
+        case detail::isa::avx2: return detail::avx2_sum(first, last);
+        case detail::isa::sse42: return detail::sse42_sum(first, last);
+        default: break;
+      }
+    }
+#endif
+    return scalar::sum(first, last);
+  }
+
+  template <typename T>
+  bool contains_any(const T *first, const T *last, const T *values, std::size_t n) noexcept  // does any element equal any of the n values
+  {
+#ifdef S21_SIMD_X86
+    if constexpr (detail::vectorized<T>) {
+      switch (detail::active_isa()) {
+        case detail::isa::avx2: return detail::avx2_contains_any(first, last, values, n);
+        case detail::isa::sse42: return detail::sse42_contains_any(first, last, values, n);
+        default: break;
+      }
+    }
+#endif
+    return scalar::contains_any(first, last, values, n);
+  }
+
+// s21_vector ===================================================================================
+
+  template <typename T, typename A, typename G>
+  typename s21_vector<T, A, G>::const_iterator find(const s21_vector<T, A, G> &v, const T &value) noexcept
+  {
+    return v.begin() + (simd::find(v.data(), v.data() + v.size(), value) - v.data());
+  }
+
+  template <typename T, typename A, typename G>
+  std::size_t count(const s21_vector<T, A, G> &v, const T &value) noexcept
+  {
+    return simd::count(v.data(), v.data() + v.size(), value);
+  }
+
+  template <typename T, typename A, typename G>
+  std::pair<T, T> minmax(const s21_vector<T, A, G> &v)  // throws std::out_of_range for an empty vector
+  {
+    if (v.empty()) {
+      throw std::out_of_range("s21::simd::minmax: empty vector");
+    }
+    return simd::minmax(v.data(), v.data() + v.size());
+  }
+
+  template <typename T, typename A, typename G>
+  sum_t<T> sum(const s21_vector<T, A, G> &v) noexcept
+  {
+    return simd::sum(v.data(), v.data() + v.size());
+  }
+
+  template <typename T, typename A, typename G>
+  bool contains_any(const s21_vector<T, A, G> &v, std::initializer_list<T> values) noexcept
+  {
+    return simd::contains_any(v.data(), v.data() + v.size(), values.begin(), values.size());
+  }
+
+}  // namespace simd
+}  // namespace s21
+
+#ifdef S21_SIMD_X86
+#undef S21_TARGET_AVX2
+#undef S21_TARGET_SSE42
+#endif
+
+#endif  // SRC_S21_SIMD_H_
@@ -0,0 +1,581 @@
+#ifndef SRC_S21_SMALL_VECTOR_H_
+#define SRC_S21_SMALL_VECTOR_H_
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // s21_vector with room for N elements inside the object itself: nothing is
+  // allocated until the (N + 1)-th element arrives, and shrink_to_fit() moves
+  // the elements back in once they fit again.
+  template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+  class s21_small_vector
+  {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static_assert(N > 0, "s21_small_vector: use s21_vector when there is no inline storage");
+    static_assert(!std::is_same<T, bool>::value, "s21_small_vector: no bit-packed variant, store char");
+
+  public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using reference = T &;
+    using const_reference = const T &;
+    using size_type = typename alloc_traits::size_type;
+    using difference_type = typename alloc_traits::difference_type;
+    using iterator = typename s21_vector<T, Allocator>::iterator;
+    using const_iterator = typename s21_vector<T, Allocator>::const_iterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type inline_capacity = N;
+
+    s21_small_vector() noexcept(noexcept(Allocator())) : s21_small_vector(Allocator()) {} // default constructor, creates empty vector in the inline buffer
+
+    explicit s21_small_vector(const Allocator &alloc) noexcept // creates empty vector which spills to alloc
+        : alloc_(alloc), array_(inline_data()), size_array_(0), capacity_array_(N) {}
+
+    s21_small_vector(size_type n, const Allocator &alloc = Allocator()) : s21_small_vector(alloc)  // parameterized constructor, creates the vector of size n
+    {
+      resize(n);
+    }
+
+    s21_small_vector(std::initializer_list<value_type> const &items, const Allocator &alloc = Allocator()) // initializer list constructor
+        : s21_small_vector(alloc)
+    {
+      append_range(items.begin(), items.end());
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    s21_small_vector(InputIt first, InputIt last, const Allocator &alloc = Allocator()) : s21_small_vector(alloc) // range constructor, copies [first, last)
+    {
+      append_range(first, last);
+    }
+
+    s21_small_vector(const s21_small_vector &v) // copy constructor
+        : s21_small_vector(alloc_traits::select_on_container_copy_construction(v.alloc_))
+    {
+      append_range(v.array_, v.array_ + v.size_array_);
+    }
+
+    s21_small_vector(s21_small_vector &&v) noexcept(std::is_nothrow_move_constructible<T>::value) // move constructor
+        : s21_small_vector(v.alloc_)
+    {
+      take(v);
+    }
+
+    s21_small_vector &operator=(const s21_small_vector &v) // copy assignment
+    {
+      if (this != &v) {
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          if (alloc_ != v.alloc_) {
+            release();  // the heap buffer belongs to the allocator being replaced
+          }
+          alloc_ = v.alloc_;
+        }
+        clear();
+        append_range(v.array_, v.array_ + v.size_array_);
+      }
+      return *this;
+    }
+
+    s21_small_vector &operator=(s21_small_vector &&v) noexcept(
+        (alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) &&
+        std::is_nothrow_move_constructible<T>::value) // assignment operator overload for moving object
+    {
+      if (this != &v) {
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          release();
+          alloc_ = v.alloc_;
+          take(v);
+        } else {
+            if (alloc_traits::is_always_equal::value || alloc_ == v.alloc_) {
+              release();
+              take(v);
+            } else {  // v's heap buffer can't be freed through our allocator: move the elements over one by one
+                clear();
+                append_range(std::make_move_iterator(v.begin()), std::make_move_iterator(v.end()));
+            }
+        }
+      }
+      return *this;
+    }
+
+    ~s21_small_vector() noexcept // destructor
+    {
+      release();
+    }
+
+    allocator_type get_allocator() const noexcept  // returns the allocator used once the inline buffer is full
+    {
+      return alloc_;
+    }
+
+// Capacity =====================================================================================
+    bool empty() const noexcept // checks whether the container is empty
+    {
+      return size_array_ ? false : true;
+    }
+
+    size_type size() const noexcept  // returns the number of elements
+    {
+      return size_array_;
+    }
+
+    size_type max_size() const noexcept // returns the maximum possible number of elements
+    {
+      size_type j = 0;
+      size_type by_size = (j - 1) / sizeof(value_type) / 2;
+      size_type by_alloc = alloc_traits::max_size(alloc_);
+      return by_size < by_alloc ? by_size : by_alloc;
+    }
+
+    void reserve(size_type new_capacity_array_)  // allocate storage of size elements and relocates current array_ elements into it
+    {
+      if (new_capacity_array_ > max_size()) {
+        throw std::length_error("s21_small_vector::reserve: capacity exceeds max_size()");
+      }
+      if (new_capacity_array_ > capacity_array_) {
+        reallocate(new_capacity_array_);
+      }
+    }
+
+    void resize(size_type new_size_array, const_reference value = T())
+    {
+      if (new_size_array > size_array_) {
+        value_type tmp(value);  // value may live in the buffer reserve is about to move
+        reserve(new_size_array);
+        detail::uninitialized_fill_n(alloc_, array_ + size_array_, new_size_array - size_array_, tmp);
+      } else {
+          detail::destroy(alloc_, array_ + new_size_array, array_ + size_array_);
+      }
+      size_array_ = new_size_array;
+    }
+
+    size_type capacity() const noexcept // returns the number of elements that can be held in currently allocated storage
+    {
+      return capacity_array_;
+    }
+
+    bool is_inline() const noexcept  // checks whether the elements still live inside the object
+    {
+      return array_ == inline_data();
+    }
+
+    void shrink_to_fit()  // frees unused heap memory, going back to the inline buffer when the elements fit
+    {
+      if (!is_inline() && capacity_array_ > size_array_) {
+        reallocate(size_array_);
+      }
+    }
+
+// Modifiers ====================================================================================
+
+    void clear() noexcept  // clears the contents, keeps the storage
+    {
+      detail::destroy(alloc_, array_, array_ + size_array_);
+      size_array_ = 0;
+    }
+
+    iterator insert(const_iterator pos, const_reference value)  // inserts value before pos and returns the iterator that points to it
+    {
+      return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, value_type &&value)  // inserts value by moving it before pos
+    {
+      return emplace(pos, std::move(value));
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args)  // constructs an element in place before pos and returns the iterator to it
+    {
+      size_type index = pos - cbegin();
+      if (index == size_array_) {
+        emplace_back(std::forward<Args>(args)...);
+        return iterator(array_ + index);
+      }
+
+      value_type tmp(std::forward<Args>(args)...);  // args may refer to the tail we are about to shift
+      return insert_constructed(index, 1, [&](value_type *dest) {
+        alloc_traits::construct(alloc_, dest, std::move(tmp));
+      });
+    }
+
+    iterator insert(const_iterator pos, size_type n, const_reference value)  // inserts n copies of value before pos
+    {
+      size_type index = pos - cbegin();
+      value_type tmp(value);  // value may refer to the tail we are about to shift
+      return insert_constructed(index, n, [&](value_type *dest) {
+        detail::uninitialized_fill_n(alloc_, dest, n, tmp);
+      });
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    iterator insert(const_iterator pos, InputIt first, InputIt last)  // inserts [first, last) before pos with a single shift of the tail
+    {
+      size_type index = pos - cbegin();
+      if constexpr (detail::is_forward_iterator<InputIt>::value) {
+        size_type n = std::distance(first, last);
+        return insert_constructed(index, n, [&](value_type *dest) {
+          detail::uninitialized_copy(alloc_, first, last, dest);
+        });
+      } else {
+          if (index == size_array_) {
+            append_range(first, last);
+            return iterator(array_ + index);
+          }
+          s21_small_vector buffered(alloc_);  // single pass input: count it before touching our tail
+          buffered.append_range(first, last);
+          return insert(pos, std::make_move_iterator(buffered.array_),
+                        std::make_move_iterator(buffered.array_ + buffered.size_array_));
+      }
+    }
+
+    template <typename InputIt>
+    void append_range(InputIt first, InputIt last)  // appends [first, last), growing the buffer at most once for forward ranges
+    {
+      if constexpr (detail::is_forward_iterator<InputIt>::value) {
+        insert(end(), first, last);
+      } else {
+          for (; first != last; ++first) {
+            emplace_back(*first);
+          }
+      }
+    }
+
+    void erase(const_iterator pos)  // erases element at pos
+    {
+      value_type *ptr_ = array_ + (pos - cbegin());
+
+      if (ptr_ >= array_ + size_array_) {
+        throw std::out_of_range("Invalid pointer");
+      }
+
+      alloc_traits::destroy(alloc_, ptr_);
+      try {
+        detail::relocate_left(alloc_, ptr_ + 1, array_ + size_array_, 1);
+      } catch (...) {
+          size_array_ = ptr_ - array_;
+          throw;
+      }
+      --size_array_;
+    }
+
+    void push_back(const_reference value)
+    {
+      emplace_back(value);
+    }
+
+    void push_back(value_type &&value)  // appends value by moving it
+    {
+      emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args)  // constructs an element in place at the end
+    {
+      if (capacity_array_ == size_array_) {
+        size_type new_capacity_array = recommend(size_array_ + 1);
+        value_type *new_array = alloc_traits::allocate(alloc_, new_capacity_array);
+        try {
+          alloc_traits::construct(alloc_, new_array + size_array_, std::forward<Args>(args)...);  // before relocating: args may be ours
+        } catch (...) {
+            alloc_traits::deallocate(alloc_, new_array, new_capacity_array);
+            throw;
+        }
+        try {
+          detail::relocate(alloc_, array_, array_ + size_array_, new_array);
+        } catch (...) {
+            alloc_traits::destroy(alloc_, new_array + size_array_);
+            alloc_traits::deallocate(alloc_, new_array, new_capacity_array);
+            throw;
+        }
+        replace_buffer(new_array, new_capacity_array);
+      } else {
+          alloc_traits::construct(alloc_, array_ + size_array_, std::forward<Args>(args)...);
+      }
+      ++size_array_;
+      return back();
+    }
+
+    template <typename... Args>
+    void insert_many_back(Args&&... args)  // appends every argument
+    {
+      (emplace_back(std::forward<Args>(args)), ...);
+    }
+
+    void pop_back() noexcept // removes the last element
+    {
+      --size_array_;
+      alloc_traits::destroy(alloc_, array_ + size_array_);
+    }
+
+    void swap(s21_small_vector &other)  // swaps the contents; inline elements, or heap buffers of unequal allocators, have to be moved
+    {
+      constexpr bool propagate = alloc_traits::propagate_on_container_swap::value;
+      if (!is_inline() && !other.is_inline() && (propagate || alloc_traits::is_always_equal::value || alloc_ == other.alloc_)) {
+        if constexpr (propagate) {
+          std::swap(alloc_, other.alloc_);
+        }
+        std::swap(array_, other.array_);
+        std::swap(size_array_, other.size_array_);
+        std::swap(capacity_array_, other.capacity_array_);
+      } else if constexpr (propagate) {
+          s21_small_vector tmp(std::move(other));
+          other.release();
+          other.alloc_ = alloc_;
+          other.take(*this);
+          release();
+          alloc_ = tmp.alloc_;
+          take(tmp);
+      } else {
+          s21_small_vector tmp(std::move(other));  // each side keeps its allocator, the assignments copy where they differ
+          other = std::move(*this);
+          *this = std::move(tmp);
+      }
+    }
+
+// Element access =============================================================================
+
+    reference at(size_type j) // access specified element with bounds checking
+    {
+      if (j >= size_array_) {
+        throw std::out_of_range("s21_small_vector::at: index out of range");
+      }
+      return array_[j];
+    }
+
+    const_reference at(size_type j) const
+    {
+      if (j >= size_array_) {
+        throw std::out_of_range("s21_small_vector::at: index out of range");
+      }
+      return array_[j];
+    }
+
+    reference operator[](size_type j) noexcept // access specified element
+    {
+      return array_[j];
+    }
+
+    const_reference operator[](size_type j) const noexcept // access specified element
+    {
+      return array_[j];
+    }
+
+    reference front() noexcept // access the first element
+    {
+      return array_[0];
+    }
+
+    const_reference front() const noexcept // access the first element
+    {
+      return array_[0];
+    }
+
+    reference back() noexcept // access the last element
+    {
+      return array_[size_array_ - 1];
+    }
+
+    const_reference back() const noexcept // access the last element
+    {
+      return array_[size_array_ - 1];
+    }
+
+    value_type * data() noexcept  // direct access to the underlying array
+    {
+      return array_;
+    }
+
+    const value_type * data() const noexcept  // direct access to the underlying array
+    {
+      return array_;
+    }
+
+// Iterators ====================================================================================
+
+    iterator begin() noexcept  // returns an iterator to the beginning
+    {
+      return iterator(array_);
+    }
+
+    const_iterator begin() const noexcept
+    {
+      return const_iterator(array_);
+    }
+
+    iterator end() noexcept  // returns an iterator to the end
+    {
+      return iterator(array_ + size_array_);
+    }
+
+    const_iterator end() const noexcept
+    {
+      return const_iterator(array_ + size_array_);
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+    reverse_iterator rbegin() noexcept  // returns a reverse iterator to the last element
+    {
+      return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+      return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept  // returns a reverse iterator past the first element
+    {
+      return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crbegin() const noexcept
+    {
+      return rbegin();
+    }
+
+    const_reverse_iterator crend() const noexcept
+    {
+      return rend();
+    }
+
+  private:
+    value_type *inline_data() noexcept
+    {
+      return reinterpret_cast<value_type*>(inline_);
+    }
+
+    const value_type *inline_data() const noexcept
+    {
+      return reinterpret_cast<const value_type*>(inline_);
+    }
+
+    // destroys the elements and frees a heap buffer, leaving *this empty and inline
+    void release() noexcept
+    {
+      clear();
+      if (!is_inline()) {
+        alloc_traits::deallocate(alloc_, array_, capacity_array_);
+      }
+      array_ = inline_data();
+      capacity_array_ = N;
+    }
+
+    // takes the elements of v, stealing its heap buffer when it has one; *this must be empty and inline
+    void take(s21_small_vector &v) noexcept(std::is_nothrow_move_constructible<T>::value)
+    {
+      if (v.is_inline()) {
+        detail::relocate(alloc_, v.array_, v.array_ + v.size_array_, array_);
+        size_array_ = v.size_array_;
+      } else {
+          array_ = v.array_;
+          size_array_ = v.size_array_;
+          capacity_array_ = v.capacity_array_;
+          v.array_ = v.inline_data();
+          v.capacity_array_ = N;
+      }
+      v.size_array_ = 0;
+    }
+
+    void reallocate(size_type new_capacity_array)
+    {
+      if (new_capacity_array <= N) {
+        new_capacity_array = N;
+        if (is_inline()) {
+          return;
+        }
+      }
+      value_type *new_array = new_capacity_array == N ? inline_data()
+                                                      : alloc_traits::allocate(alloc_, new_capacity_array);
+      try {
+        detail::relocate(alloc_, array_, array_ + size_array_, new_array);
+      } catch (...) {
+          if (new_array != inline_data()) {
+            alloc_traits::deallocate(alloc_, new_array, new_capacity_array);
+          }
+          throw;
+      }
+      replace_buffer(new_array, new_capacity_array);
+    }
+
+    void replace_buffer(value_type *new_array, size_type new_capacity_array) noexcept
+    {
+      if (!is_inline()) {
+        alloc_traits::deallocate(alloc_, array_, capacity_array_);
+      }
+      array_ = new_array;
+      capacity_array_ = new_capacity_array;
+    }
+
+    // capacity for required elements: at least double the current one, at most max_size()
+    size_type recommend(std::size_t required) const
+    {
+      size_type limit = max_size();
+      if (required > limit) {
+        throw std::length_error("s21_small_vector: size exceeds max_size()");
+      }
+      std::size_t doubled = 2 * static_cast<std::size_t>(capacity_array_);
+      std::size_t grown = required > doubled ? required : doubled;
+      return grown < limit ? static_cast<size_type>(grown) : limit;
+    }
+
+    // grows at most once, shifts the tail by k at most once and lets construct fill
+    // the k raw slots at index; construct must clean up after itself if it throws
+    template <typename Construct>
+    iterator insert_constructed(size_type index, size_type k, Construct construct)
+    {
+      if (k) {
+        if (k > max_size() - size_array_) {
+          throw std::length_error("s21_small_vector: size exceeds max_size()");
+        }
+        if (size_array_ + k > capacity_array_) {
+          reserve(recommend(size_array_ + k));
+        }
+        try {
+          detail::relocate_right(alloc_, array_ + index, array_ + size_array_, k);
+        } catch (...) {
+            size_array_ = index;
+            throw;
+        }
+        try {
+          construct(array_ + index);
+        } catch (...) {
+            try {
+              detail::relocate_left(alloc_, array_ + index + k, array_ + size_array_ + k, k);
+            } catch (...) {
+                size_array_ = index;
+            }
+            throw;
+        }
+        size_array_ += k;
+      }
+      return iterator(array_ + index);
+    }
+
+    [[no_unique_address]] Allocator alloc_;
+    value_type *array_;
+    size_type size_array_;
+    size_type capacity_array_;
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+  };
+
+}
+
+#endif  // SRC_S21_SMALL_VECTOR_H_
@@ -0,0 +1,395 @@
+#ifndef SRC_S21_SOA_VECTOR_H_
+#define SRC_S21_SOA_VECTOR_H_
+
+#include <tuple>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // Rows of (Ts...) stored as one s21_vector per field, so a loop over a single
+  // field streams through a dense array instead of skipping over the others.
+  // All columns always have the same size and capacity: they are reserved
+  // together before a row is added, and a row that fails half way is rolled back.
+  // Rows are read and written through tuples of references (operator[], the
+  // iterators); data<I>() gives the raw column for kernels such as s21::simd.
+  template <typename... Ts>
+  class soa_vector
+  {
+    static_assert(sizeof...(Ts) > 0, "soa_vector: needs at least one column");
+    static_assert(!std::disjunction<std::is_same<Ts, bool>...>::value, "soa_vector: s21_vector<bool> columns have no data<I>(), use char for flags");
+
+    using indices = std::index_sequence_for<Ts...>;
+
+    template <bool Const>
+    class soa_iterator;
+
+  public:
+    using value_type = std::tuple<Ts...>;
+    using reference = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator = soa_iterator<false>;
+    using const_iterator = soa_iterator<true>;
+
+    template <std::size_t I>
+    using column_type = s21_vector<std::tuple_element_t<I, value_type>>;
+
+    static constexpr std::size_t columns = sizeof...(Ts);
+
+    soa_vector() = default; // default constructor, creates empty columns
+
+    explicit soa_vector(size_type n) // parameterized constructor, creates n value-initialized rows
+    {
+      resize(n);
+    }
+
+    soa_vector(std::initializer_list<value_type> const &rows) // initializer list constructor
+    {
+      reserve(rows.size());
+      for (const value_type &row : rows) {
+        push_back(row);
+      }
+    }
+
+    soa_vector(const soa_vector &v) = default; // copy constructor
+
+    soa_vector(soa_vector &&v) noexcept // move constructor, leaves v empty
+    {
+      swap(v);
+    }
+
+    soa_vector &operator=(const soa_vector &v) = default; // copy assignment
+
+    soa_vector &operator=(soa_vector &&v) noexcept // assignment operator overload for moving object
+    {
+      if (this != &v) {
+        soa_vector tmp(std::move(v));
+        swap(tmp);
+      }
+      return *this;
+    }
+
+    ~soa_vector() = default;
+
+// Capacity =====================================================================================
+    bool empty() const noexcept // checks whether the container is empty
+    {
+      return size() ? false : true;
+    }
+
+    size_type size() const noexcept  // returns the number of rows
+    {
+      return std::get<0>(columns_).size();
+    }
+
+    size_type capacity() const noexcept // returns the number of rows every column has room for
+    {
+      return std::get<0>(columns_).capacity();
+    }
+
+    void reserve(size_type n)  // reserves n rows in every column
+    {
+      for_each_column([n](auto &column) { column.reserve(n); });
+    }
+
+    void resize(size_type n)  // value-initializes new rows, or drops the trailing ones
+    {
+      size_type old_size = size();
+      reserve(n);
+      try {
+        for_each_column([n](auto &column) { column.resize(n); });
+      } catch (...) {
+          truncate(old_size);
+          throw;
+      }
+    }
+
+    void shrink_to_fit()
+    {
+      for_each_column([](auto &column) { column.shrink_to_fit(); });
+    }
+
+// Modifiers ====================================================================================
+    void clear() noexcept  // clears the contents
+    {
+      for_each_column([](auto &column) { column.clear(); });
+    }
+
+    void push_back(const value_type &row)  // adds a row to the end
+    {
+      emplace_row(row, indices());
+    }
+
+    void push_back(value_type &&row)
+    {
+      emplace_row(std::move(row), indices());
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args)  // adds a row built from one argument per column
+    {
+      static_assert(sizeof...(Args) == sizeof...(Ts), "soa_vector::emplace_back: one argument per column");
+      if (size() == capacity()) {
+        value_type tmp(std::forward<Args>(args)...);  // the arguments may live in the columns reserve is about to move
+        grow();
+        emplace_row(std::move(tmp), indices());
+      } else {
+          emplace_columns(indices(), std::forward<Args>(args)...);
+      }
+    }
+
+    void pop_back()  // removes the last row
+    {
+      for_each_column([](auto &column) { column.pop_back(); });
+    }
+
+    void erase(const_iterator pos)  // erases the row at pos
+    {
+      size_type index = static_cast<size_type>(pos.index_);
+      for_each_column([index](auto &column) { column.erase(column.cbegin() + index); });
+    }
+
+    void swap(soa_vector &other) noexcept  // swaps the contents
+    {
+      swap_columns(other, indices());
+    }
+
+// Element access =============================================================================
+
+    reference at(size_type j) // access specified row with bounds checking
+    {
+      if (j >= size()) {
+        throw std::out_of_range("soa_vector::at: index out of range");
+      }
+      return (*this)[j];
+    }
+
+    const_reference at(size_type j) const
+    {
+      if (j >= size()) {
+        throw std::out_of_range("soa_vector::at: index out of range");
+      }
+      return (*this)[j];
+    }
+
+    reference operator[](size_type j) noexcept // access specified row
+    {
+      return begin()[static_cast<difference_type>(j)];
+    }
+
+    const_reference operator[](size_type j) const noexcept // access specified row
+    {
+      return begin()[static_cast<difference_type>(j)];
+    }
+
+    reference front() noexcept // access the first row
+    {
+      return (*this)[0];
+    }
+
+    const_reference front() const noexcept // access the first row
+    {
+      return (*this)[0];
+    }
+
+    reference back() noexcept // access the last row
+    {
+      return (*this)[size() - 1];
+    }
+
+    const_reference back() const noexcept // access the last row
+    {
+      return (*this)[size() - 1];
+    }
+
+    template <std::size_t I>
+    std::tuple_element_t<I, value_type> &get(size_type j) noexcept  // access field I of row j
+    {
+      return std::get<I>(columns_)[j];
+    }
+
+    template <std::size_t I>
+    const std::tuple_element_t<I, value_type> &get(size_type j) const noexcept
+    {
+      return std::get<I>(columns_)[j];
+    }
+
+    template <std::size_t I>
+    std::tuple_element_t<I, value_type> *data() noexcept  // direct access to column I, size() elements long
+    {
+      return std::get<I>(columns_).data();
+    }
+
+    template <std::size_t I>
+    const std::tuple_element_t<I, value_type> *data() const noexcept
+    {
+      return std::get<I>(columns_).data();
+    }
+
+    template <std::size_t I>
+    const column_type<I> &column() const noexcept  // column I as a read-only s21_vector
+    {
+      return std::get<I>(columns_);
+    }
+
+// Iterators ====================================================================================
+
+    iterator begin() noexcept  // returns an iterator to the first row
+    {
+      return iterator(column_pointers(indices()), 0);
+    }
+
+    const_iterator begin() const noexcept
+    {
+      return const_iterator(column_pointers(indices()), 0);
+    }
+
+    iterator end() noexcept  // returns an iterator past the last row
+    {
+      return begin() + static_cast<difference_type>(size());
+    }
+
+    const_iterator end() const noexcept
+    {
+      return begin() + static_cast<difference_type>(size());
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+  private:
+    template <bool Const>
+    class soa_iterator {  // random access over rows; dereferencing yields a tuple of references into the columns
+      friend class soa_vector;
+      friend class soa_iterator<!Const>;
+
+      using pointers = std::conditional_t<Const, std::tuple<const Ts*...>, std::tuple<Ts*...>>;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = std::tuple<Ts...>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::conditional_t<Const, std::tuple<const Ts&...>, std::tuple<Ts&...>>;
+
+        soa_iterator() : columns_(), index_(0) {}
+
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        soa_iterator(const soa_iterator<false> &other) : columns_(other.columns_), index_(other.index_) {}
+
+        reference operator*() const { return row(indices()); }
+        reference operator[](difference_type n) const { return *(*this + n); }
+
+        soa_iterator &operator++() { ++index_; return *this; }
+        soa_iterator operator++(int) { soa_iterator tmp(*this); ++index_; return tmp; }
+        soa_iterator &operator--() { --index_; return *this; }
+        soa_iterator operator--(int) { soa_iterator tmp(*this); --index_; return tmp; }
+        soa_iterator &operator+=(difference_type n) { index_ += n; return *this; }
+        soa_iterator &operator-=(difference_type n) { index_ -= n; return *this; }
+
+        friend soa_iterator operator+(soa_iterator it, difference_type n) { return it += n; }
+        friend soa_iterator operator+(difference_type n, soa_iterator it) { return it += n; }
+        friend soa_iterator operator-(soa_iterator it, difference_type n) { return it -= n; }
+
+        template <bool C>
+        difference_type operator-(const soa_iterator<C> &other) const { return index_ - other.index_; }
+        template <bool C>
+        bool operator==(const soa_iterator<C> &other) const { return index_ == other.index_; }
+        template <bool C>
+        bool operator!=(const soa_iterator<C> &other) const { return index_ != other.index_; }
+        template <bool C>
+        bool operator<(const soa_iterator<C> &other) const { return index_ < other.index_; }
+        template <bool C>
+        bool operator>(const soa_iterator<C> &other) const { return index_ > other.index_; }
+        template <bool C>
+        bool operator<=(const soa_iterator<C> &other) const { return index_ <= other.index_; }
+        template <bool C>
+        bool operator>=(const soa_iterator<C> &other) const { return index_ >= other.index_; }
+
+      private:
+        soa_iterator(const pointers &columns, difference_type index) : columns_(columns), index_(index) {}
+
+        template <std::size_t... I>
+        reference row(std::index_sequence<I...>) const { return reference(std::get<I>(columns_)[index_]...); }
+
+        pointers columns_;
+        difference_type index_;
+    };
+
+    template <typename F>
+    void for_each_column(F f)
+    {
+      std::apply([&f](auto &... column) { (f(column), ...); }, columns_);
+    }
+
+    void truncate(size_type n) noexcept  // drops whatever a failed operation appended past n rows
+    {
+      for_each_column([n](auto &column) {
+        while (column.size() > n) {
+          column.pop_back();
+        }
+      });
+    }
+
+    void grow()
+    {
+      reserve(growth::doubling<>::grow(capacity(), size() + 1, sizeof(value_type)));
+    }
+
+    template <typename Row, std::size_t... I>
+    void emplace_row(Row &&row, std::index_sequence<I...>)  // row is a tuple, copied or moved field by field
+    {
+      if (size() == capacity()) {
+        value_type tmp(std::forward<Row>(row));  // row may be made of elements reserve is about to move
+        grow();
+        emplace_columns(indices(), std::get<I>(std::move(tmp))...);
+      } else {
+          emplace_columns(indices(), std::get<I>(std::forward<Row>(row))...);
+      }
+    }
+
+    template <std::size_t... I, typename... Args>
+    void emplace_columns(std::index_sequence<I...>, Args&&... args)  // capacity is already there, so only a constructor can throw
+    {
+      size_type old_size = size();
+      try {
+        (std::get<I>(columns_).emplace_back(std::forward<Args>(args)), ...);
+      } catch (...) {
+          truncate(old_size);
+          throw;
+      }
+    }
+
+    template <std::size_t... I>
+    void swap_columns(soa_vector &other, std::index_sequence<I...>) noexcept
+    {
+      (std::get<I>(columns_).swap(std::get<I>(other.columns_)), ...);
+    }
+
+    template <std::size_t... I>
+    std::tuple<Ts*...> column_pointers(std::index_sequence<I...>) noexcept
+    {
+      return std::tuple<Ts*...>(std::get<I>(columns_).data()...);
+    }
+
+    template <std::size_t... I>
+    std::tuple<const Ts*...> column_pointers(std::index_sequence<I...>) const noexcept
+    {
+      return std::tuple<const Ts*...>(std::get<I>(columns_).data()...);
+    }
+
+    std::tuple<s21_vector<Ts>...> columns_;
+  };
+
+}
+
+#endif  // SRC_S21_SOA_VECTOR_H_
@@ -0,0 +1,246 @@
+#ifndef SRC_S21_SPAN_H_
+#define SRC_S21_SPAN_H_
+
+#include "s21_soa_vector.h"
+
+namespace s21 {
+
+  namespace detail {
+
+    // a container whose data() points at size() contiguous value_type elements;
+    // s21_vector<bool> is not one, its data() is the bit words
+    template <typename Container, typename = void>
+    struct is_contiguous_container : std::false_type {};
+
+    template <typename Container>
+    struct is_contiguous_container<Container, std::void_t<decltype(std::declval<Container&>().data()),
+                                                          decltype(std::declval<Container&>().size()),
+                                                          typename std::remove_reference_t<Container>::value_type>>
+        : std::is_same<std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<Container&>().data())>>,
+                       std::remove_cv_t<typename std::remove_reference_t<Container>::value_type>> {};
+
+    template <typename Container>
+    using container_element_t = std::remove_pointer_t<decltype(std::declval<Container&>().data())>;
+
+  }  // namespace detail
+
+  template <typename T>
+  class span_chunks;
+
+  // Non-owning view of size() contiguous elements: a pointer and a length that
+  // can be passed by value instead of copying a sub-range into a new vector.
+  // span<const T> is the read-only view. It is built from anything with
+  // data() and size() (s21_vector, s21_small_vector, mapped_vector, ...), from
+  // a column of an soa_vector with column_span<I>(), or from a raw buffer. The
+  // viewed storage must outlive the span and not be reallocated under it.
+  template <typename T>
+  class span
+  {
+  public:
+    using element_type = T;
+    using value_type = std::remove_cv_t<T>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T &;
+    using iterator = T *;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);
+
+    constexpr span() noexcept : data_(nullptr), size_(0) {} // default constructor, views nothing
+
+    constexpr span(T *ptr, size_type n) noexcept : data_(ptr), size_(n) {} // views n elements at ptr
+
+    template <typename End, typename = std::enable_if_t<std::is_convertible<End, T*>::value && !std::is_convertible<End, size_type>::value>>
+    constexpr span(T *first, End last) noexcept : data_(first), size_(static_cast<size_type>(static_cast<T*>(last) - first)) {} // views [first, last); a literal 0 picks the count overload
+
+    template <std::size_t N>
+    constexpr span(T (&array)[N]) noexcept : data_(array), size_(N) {} // views a C array
+
+    template <typename Container, typename = std::enable_if_t<
+                  detail::is_contiguous_container<Container>::value &&
+                  std::is_convertible<detail::container_element_t<Container> (*)[], T (*)[]>::value>>
+    constexpr span(Container &c) noexcept(noexcept(c.data())) : data_(c.data()), size_(c.size()) {} // views the elements of c
+
+    template <typename U, typename = std::enable_if_t<!std::is_same<U, T>::value && std::is_convertible<U (*)[], T (*)[]>::value>>
+    constexpr span(const span<U> &other) noexcept : data_(other.data()), size_(other.size()) {} // span<T> to span<const T>
+
+    constexpr span(const span &other) noexcept = default;
+    constexpr span &operator=(const span &other) noexcept = default;
+
+// Capacity =====================================================================================
+    constexpr bool empty() const noexcept { return size_ == 0; }
+
+    constexpr size_type size() const noexcept { return size_; }
+
+    constexpr size_type size_bytes() const noexcept { return size_ * sizeof(T); }
+
+// Element access =============================================================================
+    constexpr reference at(size_type j) const // access specified element with bounds checking
+    {
+      if (j >= size_) {
+        throw std::out_of_range("span::at: index out of range");
+      }
+      return data_[j];
+    }
+
+    constexpr reference operator[](size_type j) const noexcept { return data_[j]; }
+
+    constexpr reference front() const noexcept { return data_[0]; }
+
+    constexpr reference back() const noexcept { return data_[size_ - 1]; }
+
+    constexpr pointer data() const noexcept { return data_; }
+
+// Subviews =====================================================================================
+    constexpr span first(size_type n) const  // the first n elements
+    {
+      if (n > size_) {
+        throw std::out_of_range("span::first: count out of range");
+      }
+      return span(data_, n);
+    }
+
+    constexpr span last(size_type n) const  // the last n elements
+    {
+      if (n > size_) {
+        throw std::out_of_range("span::last: count out of range");
+      }
+      return span(data_ + (size_ - n), n);
+    }
+
+    constexpr span subspan(size_type offset, size_type count = npos) const  // count elements from offset, or all the rest
+    {
+      if (offset > size_ || (count != npos && count > size_ - offset)) {
+        throw std::out_of_range("span::subspan: range out of bounds");
+      }
+      return span(data_ + offset, count == npos ? size_ - offset : count);
+    }
+
+    constexpr span_chunks<T> chunks(size_type n) const;  // consecutive spans of n elements, the last one may be shorter
+
+// Iterators ====================================================================================
+    constexpr iterator begin() const noexcept { return data_; }
+    constexpr iterator end() const noexcept { return data_ + size_; }
+
+    constexpr reverse_iterator rbegin() const noexcept { return reverse_iterator(end()); }
+    constexpr reverse_iterator rend() const noexcept { return reverse_iterator(begin()); }
+
+  private:
+    T *data_;
+    size_type size_;
+  };
+
+  template <typename T>
+  span(T *, std::size_t) -> span<T>;
+
+  template <typename T>
+  span(T *, T *) -> span<T>;
+
+  template <typename T, std::size_t N>
+  span(T (&)[N]) -> span<T>;
+
+  template <typename Container, typename = std::enable_if_t<detail::is_contiguous_container<Container>::value>>
+  span(Container &) -> span<detail::container_element_t<Container>>;
+
+  // The pieces span::chunks() cuts a span into, as a range of spans: meant for
+  // handing one piece to each worker thread. size() is the number of pieces.
+  template <typename T>
+  class span_chunks
+  {
+  public:
+    using value_type = span<T>;
+    using size_type = std::size_t;
+
+    class iterator {  // forward iterator yielding one chunk at a time
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = span<T>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = span<T>;
+
+        constexpr iterator() noexcept : whole_(), chunk_(0), offset_(0) {}
+
+        constexpr span<T> operator*() const noexcept
+        {
+          size_type rest = whole_.size() - offset_;
+          return span<T>(whole_.data() + offset_, rest < chunk_ ? rest : chunk_);
+        }
+
+        constexpr iterator &operator++() noexcept
+        {
+          size_type rest = whole_.size() - offset_;
+          offset_ += rest < chunk_ ? rest : chunk_;
+          return *this;
+        }
+
+        constexpr iterator operator++(int) noexcept
+        {
+          iterator tmp(*this);
+          ++*this;
+          return tmp;
+        }
+
+        constexpr bool operator==(const iterator &other) const noexcept { return offset_ == other.offset_; }
+        constexpr bool operator!=(const iterator &other) const noexcept { return offset_ != other.offset_; }
+
+      private:
+        friend class span_chunks;
+
+        constexpr iterator(span<T> whole, size_type chunk, size_type offset) noexcept : whole_(whole), chunk_(chunk), offset_(offset) {}
+
+        span<T> whole_;
+        size_type chunk_;
+        size_type offset_;
+    };
+
+    constexpr span_chunks(span<T> whole, size_type chunk) : whole_(whole), chunk_(chunk)
+    {
+      if (chunk == 0) {
+        throw std::invalid_argument("span::chunks: chunk size must not be zero");
+      }
+    }
+
+    constexpr size_type size() const noexcept { return (whole_.size() + chunk_ - 1) / chunk_; }
+
+    constexpr bool empty() const noexcept { return whole_.empty(); }
+
+    constexpr span<T> operator[](size_type j) const noexcept  // chunk j
+    {
+      size_type offset = j * chunk_;
+      size_type rest = whole_.size() - offset;
+      return span<T>(whole_.data() + offset, rest < chunk_ ? rest : chunk_);
+    }
+
+    constexpr iterator begin() const noexcept { return iterator(whole_, chunk_, 0); }
+    constexpr iterator end() const noexcept { return iterator(whole_, chunk_, whole_.size()); }
+
+  private:
+    span<T> whole_;
+    size_type chunk_;
+  };
+
+  template <typename T>
+  constexpr span_chunks<T> span<T>::chunks(size_type n) const
+  {
+    return span_chunks<T>(*this, n);
+  }
+
+  // column I of an soa_vector as a span, size() elements long
+  template <std::size_t I, typename... Ts>
+  span<std::tuple_element_t<I, std::tuple<Ts...>>> column_span(soa_vector<Ts...> &v) noexcept
+  {
+    return {v.template data<I>(), v.size()};
+  }
+
+  template <std::size_t I, typename... Ts>
+  span<const std::tuple_element_t<I, std::tuple<Ts...>>> column_span(const soa_vector<Ts...> &v) noexcept
+  {
+    return {v.template data<I>(), v.size()};
+  }
+
+}
+
+#endif  // SRC_S21_SPAN_H_
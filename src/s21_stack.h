@@ -3,11 +3,17 @@
 
 // #include <iostream> // nah! 
 
+#include <new>
+
 namespace s21 {
 
+  struct serial_access;  // lets s21_serialize.h walk the nodes without copying the container
+
   template <typename T>
   class s21_stack 
   {
+    friend struct serial_access;
+
     using value_type = T; // T the template parameter T
     using reference = T &;  // defines the type of the reference to an element
     using const_reference = const T &;  // defines the type of the constant reference
@@ -117,7 +123,7 @@ namespace s21 {
         top_ = new_node;
       }
       
-      new_node->data_ = reinterpret_cast<value_type*>(operator new(sizeof(value_type)));
+      new_node->data_ = static_cast<value_type*>(::operator new(sizeof(value_type), std::align_val_t(alignof(value_type))));  // honours over-aligned T
       try {
         new (new_node->data_) T(value);  // placement new
         ++size_;  
@@ -130,7 +136,7 @@ namespace s21 {
     {
       if (top_) {
         top_->data_->~T();
-        delete reinterpret_cast<int8_t*>(top_->data_);
+        ::operator delete(top_->data_, std::align_val_t(alignof(value_type)));
         Node * tmp = top_->next_;
         delete top_;
         top_ = tmp;
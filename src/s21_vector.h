@@ -1,285 +1,742 @@
 #ifndef SRC_S21_VECTOR_H_
 #define SRC_S21_VECTOR_H_
 
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+// C++20 allows allocating in constant expressions as long as everything is freed
+// again; when the compiler and library support that, s21_vector is constexpr.
+#if defined(__cpp_constexpr_dynamic_alloc) && defined(__cpp_lib_constexpr_dynamic_alloc)
+#define S21_CONSTEXPR20 constexpr
+#else
+#define S21_CONSTEXPR20
+#endif
+
 namespace s21 {
 
+  // A type is trivially relocatable when moving it to a new address and ending
+  // the lifetime of the source is equivalent to a memcpy. Trivially copyable
+  // types are, and a user type holding only owning pointers may specialize this.
   template <typename T>
-  class s21_vector 
+  struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+  // Tag for constructors that default-initialize: trivially constructible elements
+  // are left with whatever bytes the buffer had, to be overwritten by the caller.
+  struct default_init_t {
+    explicit default_init_t() = default;
+  };
+  inline constexpr default_init_t default_init{};
+
+  namespace detail {
+
+    // memcpy and memmove are not allowed in constant evaluation: the relocation
+    // helpers take their element by element paths there instead
+    constexpr bool is_constant_evaluated() noexcept
+    {
+#ifdef __cpp_lib_is_constant_evaluated
+      return std::is_constant_evaluated();
+#else
+      return false;
+#endif
+    }
+
+    template <typename It, typename = void>
+    struct is_forward_iterator : std::false_type {};
+
+    template <typename It>
+    struct is_forward_iterator<It, std::void_t<typename std::iterator_traits<It>::iterator_category>>
+        : std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<It>::iterator_category> {};
+
+    // An allocator may offer reallocate(ptr, old_n, new_n) to resize a buffer without
+    // copying it (realloc, mremap); the bytes may move, so s21_vector only uses it for
+    // trivially relocatable elements.
+    template <typename Alloc, typename = void>
+    struct has_reallocate : std::false_type {};
+
+    template <typename Alloc>
+    struct has_reallocate<Alloc, std::void_t<decltype(std::declval<Alloc&>().reallocate(
+        std::declval<typename std::allocator_traits<Alloc>::pointer>(), std::size_t(), std::size_t()))>>
+        : std::true_type {};
+
+    // An allocator may also watch what the vector does with its buffers (see
+    // stats_allocator): on_relocate(bytes) hears about elements moved to a new
+    // address, on_release(capacity_bytes, used_bytes) about buffers given back.
+    // Allocators without the hooks pay nothing for them.
+    template <typename Alloc, typename = void>
+    struct has_buffer_hooks : std::false_type {};
+
+    template <typename Alloc>
+    struct has_buffer_hooks<Alloc, std::void_t<decltype(std::declval<Alloc&>().on_relocate(std::size_t())),
+                                               decltype(std::declval<Alloc&>().on_release(std::size_t(), std::size_t()))>>
+        : std::true_type {};
+
+    template <typename Alloc>
+    S21_CONSTEXPR20 void note_relocate(Alloc &alloc, std::size_t bytes) noexcept
+    {
+      if constexpr (has_buffer_hooks<Alloc>::value) {
+        if (bytes) {
+          alloc.on_relocate(bytes);
+        }
+      }
+    }
+
+    // move when it cannot throw (or when there is no copy to fall back to)
+    template <typename T>
+    constexpr bool relocate_by_move =
+        std::is_nothrow_move_constructible<T>::value || !std::is_copy_constructible<T>::value;
+
+    template <typename Alloc, typename T>
+    S21_CONSTEXPR20 void destroy(Alloc &alloc, T *first, T *last) noexcept  // destroys [first, last) through the allocator
+    {
+      if constexpr (!std::is_trivially_destructible<T>::value) {
+        for (; first != last; ++first) {
+          std::allocator_traits<Alloc>::destroy(alloc, first);
+        }
+      }
+    }
+
+    // copies [first, last) into the raw storage at dest, on throw nothing is left constructed
+    template <typename Alloc, typename InputIt, typename T>
+    S21_CONSTEXPR20 T *uninitialized_copy(Alloc &alloc, InputIt first, InputIt last, T *dest)
+    {
+      T *current = dest;
+      try {
+        for (; first != last; ++first, ++current) {
+          std::allocator_traits<Alloc>::construct(alloc, current, *first);
+        }
+      } catch (...) {
+          detail::destroy(alloc, dest, current);
+          throw;
+      }
+      return current;
+    }
+
+    // constructs n elements from args in the raw storage at dest, on throw nothing is left constructed
+    template <typename Alloc, typename T, typename... Args>
+    S21_CONSTEXPR20 T *uninitialized_fill_n(Alloc &alloc, T *dest, std::size_t n, const Args&... args)
+    {
+      T *current = dest;
+      try {
+        for (; n; --n, ++current) {
+          std::allocator_traits<Alloc>::construct(alloc, current, args...);
+        }
+      } catch (...) {
+          detail::destroy(alloc, dest, current);
+          throw;
+      }
+      return current;
+    }
+
+    // default-initializes n elements at dest: nothing to do for trivial types
+    template <typename Alloc, typename T>
+    S21_CONSTEXPR20 void uninitialized_default_n(Alloc &alloc, T *dest, std::size_t n)
+    {
+      if constexpr (!std::is_trivially_default_constructible<T>::value) {
+        detail::uninitialized_fill_n(alloc, dest, n);
+      } else {
+        if (detail::is_constant_evaluated()) {  // a constant expression may not leave an element uninitialized
+          detail::uninitialized_fill_n(alloc, dest, n);
+        }
+      }
+    }
+
+    // relocates [first, last) into the raw storage at dest, the source range is left raw;
+    // the buffers must not overlap. Strong guarantee: on throw nothing has been relocated.
+    template <typename Alloc, typename T>
+    S21_CONSTEXPR20 void relocate(Alloc &alloc, T *first, T *last, T *dest)
+    {
+      detail::note_relocate(alloc, (last - first) * sizeof(T));
+      if constexpr (is_trivially_relocatable<T>::value) {
+        if (!detail::is_constant_evaluated()) {
+          if (first != last) {
+            std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first),
+                        (last - first) * sizeof(T));
+          }
+          return;
+        }
+      }
+      if constexpr (relocate_by_move<T>) {
+        for (; first != last; ++first, ++dest) {
+          std::allocator_traits<Alloc>::construct(alloc, dest, std::move(*first));
+          std::allocator_traits<Alloc>::destroy(alloc, first);
+        }
+      } else {
+        detail::uninitialized_copy(alloc, first, last, dest);
+        detail::destroy(alloc, first, last);
+      }
+    }
+
+    // moves [first, last) up by k slots inside one buffer, leaving [first, first + k) raw.
+    // If an element copy throws, the whole range [first, last + k) is left raw.
+    template <typename Alloc, typename T>
+    S21_CONSTEXPR20 void relocate_right(Alloc &alloc, T *first, T *last, std::size_t k)
+    {
+      detail::note_relocate(alloc, (last - first) * sizeof(T));
+      if constexpr (is_trivially_relocatable<T>::value) {
+        if (!detail::is_constant_evaluated()) {
+          if (first != last) {
+            std::memmove(static_cast<void*>(first + k), static_cast<const void*>(first),
+                         (last - first) * sizeof(T));
+          }
+          return;
+        }
+      }
+      T *ptr = last;
+      try {
+        while (ptr != first) {
+          --ptr;
+          std::allocator_traits<Alloc>::construct(alloc, ptr + k, std::move_if_noexcept(*ptr));
+          std::allocator_traits<Alloc>::destroy(alloc, ptr);
+        }
+      } catch (...) {
+        detail::destroy(alloc, first, ptr + 1);
+        detail::destroy(alloc, ptr + 1 + k, last + k);
+        throw;
+      }
+    }
+
+    // moves [first, last) down by k slots inside one buffer, leaving [last - k, last) raw.
+    // If an element copy throws, the whole range [first - k, last) is left raw.
+    template <typename Alloc, typename T>
+    S21_CONSTEXPR20 void relocate_left(Alloc &alloc, T *first, T *last, std::size_t k)
+    {
+      detail::note_relocate(alloc, (last - first) * sizeof(T));
+      if constexpr (is_trivially_relocatable<T>::value) {
+        if (!detail::is_constant_evaluated()) {
+          if (first != last) {
+            std::memmove(static_cast<void*>(first - k), static_cast<const void*>(first),
+                         (last - first) * sizeof(T));
+          }
+          return;
+        }
+      }
+      T *ptr = first;
+      try {
+        for (; ptr != last; ++ptr) {
+          std::allocator_traits<Alloc>::construct(alloc, ptr - k, std::move_if_noexcept(*ptr));
+          std::allocator_traits<Alloc>::destroy(alloc, ptr);
+        }
+      } catch (...) {
+        detail::destroy(alloc, first - k, ptr - k);
+        detail::destroy(alloc, ptr, last);
+        throw;
+      }
+    }
+
+  }  // namespace detail
+
+  // Growth policies decide the capacity s21_vector grows to once it is full:
+  // grow(capacity, required, element_size) returns at least required elements.
+  namespace growth {
+
+    template <std::size_t MinCapacity = 1>
+    struct doubling  // classic 2x: fewest reallocations, up to 50% of the buffer unused
+    {
+      static constexpr std::size_t grow(std::size_t capacity, std::size_t required, std::size_t) noexcept
+      {
+        std::size_t next = capacity ? 2 * capacity : MinCapacity;
+        return required > next ? required : next;
+      }
+    };
+
+    template <std::size_t MinCapacity = 1>
+    struct one_and_half  // 1.5x: at most 33% unused, and the sum of freed blocks eventually fits the next one
+    {
+      static constexpr std::size_t grow(std::size_t capacity, std::size_t required, std::size_t) noexcept
+      {
+        std::size_t next = capacity ? capacity + (capacity + 1) / 2 : MinCapacity;
+        return required > next ? required : next;
+      }
+    };
+
+    // Rounds what Base asks for up to the size class a malloc-style allocator would
+    // hand out anyway (16 byte steps up to 128 bytes, then four classes per power
+    // of two), so the slack the allocator reserves is usable capacity.
+    template <typename Base = doubling<>>
+    struct size_class
+    {
+      static constexpr std::size_t grow(std::size_t capacity, std::size_t required, std::size_t element_size) noexcept
+      {
+        std::size_t elements = Base::grow(capacity, required, element_size);
+        std::size_t bytes = round_up(elements * element_size);
+        return bytes / element_size > elements ? bytes / element_size : elements;
+      }
+
+      static constexpr std::size_t round_up(std::size_t bytes) noexcept
+      {
+        if (bytes <= 128) {
+          return (bytes + 15) & ~std::size_t(15);
+        }
+        std::size_t power = 64;
+        while (2 * power < bytes) {  // power < bytes <= 2 * power after the loop
+          power *= 2;
+        }
+        std::size_t step = power / 4;
+        return (bytes + step - 1) / step * step;
+      }
+    };
+
+  }  // namespace growth
+
+  template <typename T, typename Allocator = std::allocator<T>, typename GrowthPolicy = growth::doubling<>>
+  class s21_vector
   {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+  public:
     using value_type = T;
+    using allocator_type = Allocator;
+    using growth_policy = GrowthPolicy;
     using reference = T &;
     using const_reference = const T &;
-    using size_type = size_t;
-    
-  public:
+    using size_type = typename alloc_traits::size_type;
+    using difference_type = typename alloc_traits::difference_type;
+
+    static_assert(std::is_same<typename alloc_traits::value_type, T>::value,
+                  "s21_vector: allocator_type::value_type must be T");
+    static_assert(std::is_same<typename alloc_traits::pointer, T*>::value,
+                  "s21_vector: allocators with fancy pointers are not supported");
+
     class s21_vectorIterator;
+    class s21_vectorConstIterator;
     using iterator = s21_vectorIterator;
-    
-    // using const_iterator = s21_vectorConstIterator;
-    
-    s21_vector() noexcept : array_(nullptr), size_array_(0), capacity_array_(0) {}; // default constructor, creates empty vector
-    
-    s21_vector(size_type n) : s21_vector()  // parameterized constructor, creates the vector of size n
+    using const_iterator = s21_vectorConstIterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    S21_CONSTEXPR20 s21_vector() noexcept(noexcept(Allocator())) : s21_vector(Allocator()) {} // default constructor, creates empty vector
+
+    S21_CONSTEXPR20 explicit s21_vector(const Allocator &alloc) noexcept // creates empty vector which will allocate from alloc
+        : alloc_(alloc), array_(nullptr), size_array_(0), capacity_array_(0) {}
+
+    S21_CONSTEXPR20 s21_vector(size_type n, const Allocator &alloc = Allocator()) : s21_vector(alloc)  // parameterized constructor, creates the vector of size n
     {
       if (n) {
         resize(n);
       }
     }
 
-    s21_vector(std::initializer_list<value_type> const &items) : s21_vector() // initializer list constructor, creates vector initizialized using std::initializer_list
+    S21_CONSTEXPR20 s21_vector(size_type n, default_init_t, const Allocator &alloc = Allocator()) : s21_vector(alloc)  // creates n default-initialized elements, see resize_default_init
+    {
+      resize_default_init(n);
+    }
+
+    S21_CONSTEXPR20 s21_vector(size_type n, const_reference value, const Allocator &alloc = Allocator()) : s21_vector(alloc)  // creates n copies of value
+    {
+      resize(n, value);
+    }
+
+    S21_CONSTEXPR20 s21_vector(std::initializer_list<value_type> const &items, const Allocator &alloc = Allocator()) // initializer list constructor, creates vector initizialized using std::initializer_list
+        : s21_vector(alloc)
     {
       reserve(items.size());
-      for (const auto &tmp : items) {
-        try {
-          new (array_ + size_array_) T(tmp);   // placement new
-          ++size_array_;  
-        } catch (...) {
-            throw;
-        }
-      }
+      detail::uninitialized_copy(alloc_, items.begin(), items.end(), array_);
+      size_array_ = items.size();
     }
 
-    s21_vector(const s21_vector &v) // copy constructor
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    S21_CONSTEXPR20 s21_vector(InputIt first, InputIt last, const Allocator &alloc = Allocator()) : s21_vector(alloc) // range constructor, copies [first, last)
     {
-      array_ = 
-          reinterpret_cast<value_type*>(new int8_t[v.capacity_array_ * sizeof(value_type)]);
-      
+      append_range(first, last);
+    }
+
+    S21_CONSTEXPR20 s21_vector(const s21_vector &v) // copy constructor
+        : s21_vector(v, alloc_traits::select_on_container_copy_construction(v.alloc_)) {}
+
+    S21_CONSTEXPR20 s21_vector(const s21_vector &v, const Allocator &alloc) : s21_vector(alloc) // copy constructor with an explicit allocator
+    {
+      array_ = allocate(v.capacity_array_);
       try {
-          std::uninitialized_copy(v.array_, v.array_ + v.size_array_, array_);
-        } catch (...) {
-            delete [] reinterpret_cast<int8_t*>(array_);
-            throw;
-        }
-      
+        detail::uninitialized_copy(alloc_, v.array_, v.array_ + v.size_array_, array_);
+      } catch (...) {
+          deallocate(array_, v.capacity_array_);
+          throw;
+      }
       capacity_array_ = v.capacity_array_;
       size_array_ = v.size_array_;
     }
 
-    s21_vector(s21_vector &&v) noexcept : s21_vector() // move constructor
+    S21_CONSTEXPR20 s21_vector(s21_vector &&v) noexcept // move constructor
+        : alloc_(std::move(v.alloc_)), array_(v.array_), size_array_(v.size_array_), capacity_array_(v.capacity_array_)
     {
-      this->clear();
-      delete [] reinterpret_cast<int8_t*>(this->array_);
-      
-      array_ = v.array_;
-      size_array_ = v.size_array_;
-      capacity_array_ = v.capacity_array_;
-      
       v.array_ = nullptr;
+      v.size_array_ = 0;
+      v.capacity_array_ = 0;
     }
 
-    s21_vector &operator=(s21_vector &&v) noexcept // assignment operator overload for moving object
+    S21_CONSTEXPR20 s21_vector(s21_vector &&v, const Allocator &alloc) : s21_vector(alloc) // move constructor with an explicit allocator
     {
-      this->clear();
-      delete [] reinterpret_cast<int8_t*>(this->array_);
-      
-      array_ = v.array_;
-      size_array_ = v.size_array_;
-      capacity_array_ = v.capacity_array_;
-      
-      v.array_ = nullptr;
+      if (alloc_ == v.alloc_) {
+        steal(v);
+      } else {
+          reserve(v.size_array_);
+          detail::uninitialized_copy(alloc_, std::make_move_iterator(v.array_),
+                                     std::make_move_iterator(v.array_ + v.size_array_), array_);
+          size_array_ = v.size_array_;
+      }
+    }
 
+    S21_CONSTEXPR20 s21_vector &operator=(const s21_vector &v) // copy assignment, propagates the allocator when its traits ask for it
+    {
+      if (this != &v) {
+        if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+          if (alloc_ != v.alloc_) {
+            release();
+          }
+          alloc_ = v.alloc_;
+        }
+        clear();
+        reserve(v.size_array_);
+        detail::uninitialized_copy(alloc_, v.array_, v.array_ + v.size_array_, array_);
+        size_array_ = v.size_array_;
+      }
       return *this;
     }
 
-    ~s21_vector() noexcept // destructor
+    S21_CONSTEXPR20 s21_vector &operator=(s21_vector &&v) noexcept(alloc_traits::propagate_on_container_move_assignment::value ||
+                                                   alloc_traits::is_always_equal::value) // assignment operator overload for moving object
     {
-      if (array_) {
-        for (size_t j = 0; j != size_array_; ++j) {
-          (array_ + j)->~T();
-        }        
-        delete [] reinterpret_cast<int8_t*>(array_);
+      if (this != &v) {
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+          release();
+          alloc_ = std::move(v.alloc_);
+          steal(v);
+        } else {
+            if (alloc_ == v.alloc_) {
+              release();
+              steal(v);
+            } else {  // our allocator stays, so the elements have to move one by one
+                clear();
+                reserve(v.size_array_);
+                detail::uninitialized_copy(alloc_, std::make_move_iterator(v.array_),
+                                           std::make_move_iterator(v.array_ + v.size_array_), array_);
+                size_array_ = v.size_array_;
+            }
+        }
       }
+      return *this;
+    }
+
+    S21_CONSTEXPR20 ~s21_vector() noexcept // destructor
+    {
+      release();
+    }
+
+    S21_CONSTEXPR20 allocator_type get_allocator() const noexcept  // returns the allocator the elements live in
+    {
+      return alloc_;
     }
 
 // Capacity =====================================================================================
-    bool empty() const noexcept // checks whether the container is empty
+    S21_CONSTEXPR20 bool empty() const noexcept // checks whether the container is empty
     {
       return size_array_ ? false : true;
     }
 
-    size_type size() const noexcept  // returns the number of elements
+    S21_CONSTEXPR20 size_type size() const noexcept  // returns the number of elements
     {
       return size_array_;
     }
 
-    size_type max_size() const noexcept // returns the maximum possible number of elements
+    S21_CONSTEXPR20 size_type max_size() const noexcept // returns the maximum possible number of elements
     {
-      size_type j = 0;
-      return (j - 1) / sizeof(value_type) / 2;
+      size_type by_size = static_cast<size_type>(static_cast<size_type>(-1) / sizeof(value_type) / 2);  // no promotion for a narrow size_type
+      size_type by_alloc = alloc_traits::max_size(alloc_);
+      return by_size < by_alloc ? by_size : by_alloc;
     }
 
-    void reserve(size_type new_capacity_array_)  // allocate storage of size elements and copies current array_ elements to a newely allocated array_
+    S21_CONSTEXPR20 void reserve(size_type new_capacity_array_)  // allocate storage of size elements and relocates current array_ elements to a newely allocated array_
     {
+      if (new_capacity_array_ > max_size()) {
+        throw std::length_error("s21_vector::reserve: capacity exceeds max_size()");
+      }
       if (new_capacity_array_ > capacity_array_) {
-        value_type *new_array = 
-          reinterpret_cast<value_type*>(new int8_t[new_capacity_array_ * sizeof(value_type)]);
+        reallocate(new_capacity_array_);
+      }
+    }
 
-        try {
-          std::uninitialized_copy(array_, array_ + size_array_, new_array);
-        } catch (...) {
-            delete [] reinterpret_cast<int8_t*>(new_array);
-            throw;
-        }
+    S21_CONSTEXPR20 void resize(size_type new_size_array)  // value-initializes the new elements in place
+    {
+      if (new_size_array > size_array_) {
+        reserve(new_size_array);
+        detail::uninitialized_fill_n(alloc_, array_ + size_array_, new_size_array - size_array_);
+      } else {
+          detail::destroy(alloc_, array_ + new_size_array, array_ + size_array_);
+      }
+      size_array_ = new_size_array;
+    }
 
-        for (size_t j = 0; j < size_array_; ++j) {
-          array_[j].~T();  
-        }
-        delete [] reinterpret_cast<int8_t*>(array_); // doesn't call the destructor!
-        array_ = new_array;
-        capacity_array_ = new_capacity_array_;
+    S21_CONSTEXPR20 void resize(size_type new_size_array, const_reference value)
+    {
+      if (new_size_array > size_array_) {
+        value_type tmp(value);  // value may live in the buffer reserve is about to move
+        reserve(new_size_array);
+        detail::uninitialized_fill_n(alloc_, array_ + size_array_, new_size_array - size_array_, tmp);
+      } else {
+          detail::destroy(alloc_, array_ + new_size_array, array_ + size_array_);
       }
+      size_array_ = new_size_array;
     }
 
-    void resize(size_type new_size_array, const_reference value = T())  
+    S21_CONSTEXPR20 void resize_default_init(size_type new_size_array)  // like resize(), but trivially constructible elements are left uninitialized
     {
-      if (new_size_array > capacity_array_) 
+      if (new_size_array > size_array_) {
         reserve(new_size_array);
-      
+        detail::uninitialized_default_n(alloc_, array_ + size_array_, new_size_array - size_array_);
+      } else {
+          detail::destroy(alloc_, array_ + new_size_array, array_ + size_array_);
+      }
+      size_array_ = new_size_array;
+    }
+
+    // Grows to count default-initialized elements, hands op(data(), count) the buffer and
+    // keeps the first n elements, where n <= count is what op returns. Lets a read() or a
+    // decoder write straight into the vector without zeroing it first.
+    template <typename Operation>
+    S21_CONSTEXPR20 void resize_and_overwrite(size_type count, Operation op)
+    {
+      size_type old_size = size_array_;
+      resize_default_init(count);
+      size_type filled;
       try {
-        for (size_t j = size_array_; j < new_size_array; ++j) {
-          new (array_ + j) T(value); // placement new
-        }
-        size_array_ = new_size_array; 
+        filled = static_cast<size_type>(op(array_, count));
       } catch (...) {
+          resize(old_size < count ? old_size : count);
           throw;
       }
-      
-      if (new_size_array < size_array_) {
-        size_array_ = new_size_array;
-      }
+      resize(filled < count ? filled : count);
     }
 
-    size_type capacity() const noexcept // returns the number of elements that can be held in currently allocated storage
+    S21_CONSTEXPR20 size_type capacity() const noexcept // returns the number of elements that can be held in currently allocated storage
     {
       return capacity_array_;
     }
 
-    void shrink_to_fit()  // reduces memory usage by freeing unused memory
+    S21_CONSTEXPR20 void shrink_to_fit()  // reduces memory usage by freeing unused memory
     {
       if (capacity_array_ > size_array_) {
-        value_type *new_array = 
-          reinterpret_cast<value_type*>(new int8_t[size_array_ * sizeof(value_type)]);
-
-        try {
-          std::uninitialized_copy(array_, array_ + size_array_, new_array);
-        } catch (...) {
-            delete [] reinterpret_cast<int8_t*>(new_array);
-            throw;
-        }
-
-        for (size_t j = 0; j < size_array_; ++j) {
-          array_[j].~T();  
-        }
-        delete [] reinterpret_cast<int8_t*>(array_); // doesn't call the destructor!
-        array_ = new_array;
-        capacity_array_ = size_array_;
+        reallocate(size_array_);
       }
     }
 
 // Modifiers ====================================================================================
 
-    void clear() noexcept  // clears the contents
+    S21_CONSTEXPR20 void clear() noexcept  // clears the contents
     {
-      for (size_t j = 0; j != size_array_; ++j) {
-        (array_ + j)->~T();
+      if (array_) {
+        detail::destroy(alloc_, array_, array_ + size_array_);
       }
 
       size_array_ = 0;
     }
 
-    iterator insert(iterator pos, const_reference value)  // inserts elements into concrete pos and returns the iterator that points to the new element
+    S21_CONSTEXPR20 iterator insert(const_iterator pos, const_reference value)  // inserts elements into concrete pos and returns the iterator that points to the new element
+    {
+      return emplace(pos, value);
+    }
+
+    S21_CONSTEXPR20 iterator insert(const_iterator pos, value_type &&value)  // inserts value by moving it into concrete pos
     {
-      value_type *ptr_ = &(*this->end());
-      if (pos == this->end()) {
-        push_back(value);
-        ptr_ = &(this->back());
+      return emplace(pos, std::move(value));
+    }
+
+    template <typename... Args>
+    S21_CONSTEXPR20 iterator emplace(const_iterator pos, Args&&... args)  // constructs an element in place before pos and returns the iterator to it
+    {
+      size_type index = pos - cbegin();
+      if (index == size_array_) {
+        emplace_back(std::forward<Args>(args)...);
+        return iterator(array_ + index);
+      }
+
+      value_type tmp(std::forward<Args>(args)...);  // args may refer to the tail we are about to shift
+      if (capacity_array_ == size_array_) {
+        reserve(recommend(size_array_ + 1));
+      }
+      open_gap(index, 1);
+      try {
+        alloc_traits::construct(alloc_, array_ + index, std::move(tmp));
+      } catch (...) {
+          close_gap(index, 1);
+          throw;
+      }
+      ++size_array_;
+      return iterator(array_ + index);
+    }
+
+    S21_CONSTEXPR20 iterator insert(const_iterator pos, size_type n, const_reference value)  // inserts n copies of value before pos
+    {
+      size_type index = pos - cbegin();
+      value_type tmp(value);  // value may refer to the tail we are about to shift
+      return insert_constructed(index, n, [&](value_type *dest) {
+        detail::uninitialized_fill_n(alloc_, dest, n, tmp);
+      });
+    }
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    S21_CONSTEXPR20 iterator insert(const_iterator pos, InputIt first, InputIt last)  // inserts [first, last) before pos with a single shift of the tail
+    {
+      size_type index = pos - cbegin();
+      if constexpr (detail::is_forward_iterator<InputIt>::value) {
+        std::size_t n = static_cast<std::size_t>(std::distance(first, last));  // not size_type: a narrow one would wrap
+        return insert_constructed(index, n, [&](value_type *dest) {
+          detail::uninitialized_copy(alloc_, first, last, dest);
+        });
       } else {
-          value_type *new_pos = this->array_;
-          size_t count = 0;
-          while (new_pos != &(*pos))
-          {
-            new_pos++;
-            count++;
-          }
-          if (capacity_array_ == size_array_) {
-            reserve(2 * capacity_array_);
+          if (index == size_array_) {
+            append_range(first, last);
+            return iterator(array_ + index);
           }
-          new_pos = this->array_;
-          for (size_t i = 0; i < count; i++) {
-            new_pos++;
-          }
-          ptr_ = &(*this->end());
-          size_type j = this->size_array_;
-          while(ptr_ != new_pos) {
-            try {
-              new (array_ + j) T(*(array_ + j - 1));  // placement new
-              (array_ + j - 1)->~T();
-              --ptr_;
-              --j;
-            } catch (...) {
-                throw;
-            }      
+          s21_vector buffered(alloc_);  // single pass input: count it before touching our tail
+          buffered.append_range(first, last);
+          return insert(pos, std::make_move_iterator(buffered.array_),
+                        std::make_move_iterator(buffered.array_ + buffered.size_array_));
+      }
+    }
+
+    template <typename InputIt>
+    S21_CONSTEXPR20 void append_range(InputIt first, InputIt last)  // appends [first, last), growing the buffer at most once for forward ranges
+    {
+      if constexpr (detail::is_forward_iterator<InputIt>::value) {
+        insert(end(), first, last);
+      } else {
+          for (; first != last; ++first) {
+            emplace_back(*first);
           }
-          try {
-            new (array_ + j) T(value);  // placement new
-            ++size_array_;  
-          } catch (...) {
-              throw;
-          }      
       }
-      return iterator(ptr_);
     }
 
-    void erase(iterator pos)  // erases element at pos
-    {      
-      value_type *ptr_ = &(*pos);
-      
-      if (ptr_ >= &(*(this->end()))) {
+    S21_CONSTEXPR20 void erase(const_iterator pos)  // erases element at pos
+    {
+      value_type *ptr_ = array_ + (pos - cbegin());
+
+      if (ptr_ >= array_ + size_array_) {
         throw std::out_of_range("Invalid pointer");
       }
 
-      ptr_->~T();
-      while(ptr_ != &(*(this->end())) - 1)
-      {
+      alloc_traits::destroy(alloc_, ptr_);
+      try {
+        detail::relocate_left(alloc_, ptr_ + 1, array_ + size_array_, 1);
+      } catch (...) {
+          size_array_ = ptr_ - array_;
+          throw;
+      }
+      --size_array_;
+    }
+
+    S21_CONSTEXPR20 iterator erase(const_iterator first, const_iterator last)  // erases [first, last) with a single shift of the tail
+    {
+      value_type *from = array_ + (first - cbegin());
+      value_type *to = array_ + (last - cbegin());
+
+      if (from > to || to > array_ + size_array_) {
+        throw std::out_of_range("Invalid range");
+      }
+
+      if (from != to) {
+        detail::destroy(alloc_, from, to);
         try {
-          new (ptr_) T(*(ptr_ + 1));  // placement new  
-          ptr_++;
+          detail::relocate_left(alloc_, to, array_ + size_array_, to - from);
         } catch (...) {
+            size_array_ = from - array_;
             throw;
-        }      
+        }
+        size_array_ -= to - from;
       }
-      ptr_->~T();
-      --size_array_;
+      return iterator(from);
+    }
+
+    S21_CONSTEXPR20 void push_back(const_reference value)
+    {
+      emplace_back(value);
     }
 
-    void push_back(const_reference value) 
+    S21_CONSTEXPR20 void push_back(value_type &&value)  // appends value by moving it
     {
-      if (!capacity_array_) {
-        // array_ = new value_type[1];
-        array_ = reinterpret_cast<value_type*>(new int8_t[sizeof(value_type)]);
-        ++capacity_array_;
+      emplace_back(std::move(value));
+    }
+
+    template <typename... Args>
+    S21_CONSTEXPR20 reference emplace_back(Args&&... args)  // constructs an element in place at the end
+    {
+      if constexpr (resize_in_place) {
+        if (capacity_array_ == size_array_) {
+          value_type tmp(std::forward<Args>(args)...);  // args may be ours and the buffer may move
+          reallocate(recommend(size_array_ + 1));
+          alloc_traits::construct(alloc_, array_ + size_array_, std::move(tmp));
+          ++size_array_;
+          return back();
+        }
+      }
+      if (capacity_array_ == size_array_) {
+        size_type new_capacity_array = recommend(size_array_ + 1);
+        value_type *new_array = allocate(new_capacity_array);
+        try {
+          alloc_traits::construct(alloc_, new_array + size_array_, std::forward<Args>(args)...);  // before relocating: args may be ours
+        } catch (...) {
+            deallocate(new_array, new_capacity_array);
+            throw;
+        }
+        try {
+          detail::relocate(alloc_, array_, array_ + size_array_, new_array);
+        } catch (...) {
+            alloc_traits::destroy(alloc_, new_array + size_array_);
+            deallocate(new_array, new_capacity_array);
+            throw;
+        }
+        replace_buffer(new_array, new_capacity_array);
       } else {
-          if (capacity_array_ == size_array_) {
-            reserve(2 * capacity_array_);
-          }
+          alloc_traits::construct(alloc_, array_ + size_array_, std::forward<Args>(args)...);
       }
-      
+      ++size_array_;
+      return back();
+    }
+
+    template <typename... Args>
+    S21_CONSTEXPR20 void insert_many_back(Args&&... args)  // appends every argument, growing the buffer at most once
+    {
+      size_type required = size_array_ + sizeof...(Args);
+      if (required <= capacity_array_) {
+        (emplace_back(std::forward<Args>(args)), ...);
+        return;
+      }
+
+      size_type new_capacity_array = recommend(required);
+      value_type *new_array = allocate(new_capacity_array);
+      size_type built = size_array_;
       try {
-        new (array_ + size_array_) T(value);   // placement new
-        ++size_array_;  
+        ((alloc_traits::construct(alloc_, new_array + built, std::forward<Args>(args)), ++built), ...);  // before relocating: args may be ours
+        detail::relocate(alloc_, array_, array_ + size_array_, new_array);
       } catch (...) {
+          detail::destroy(alloc_, new_array + size_array_, new_array + built);
+          deallocate(new_array, new_capacity_array);
           throw;
       }
+      replace_buffer(new_array, new_capacity_array);
+      size_array_ = built;
     }
 
-    void pop_back() noexcept // removes the last element 
+    S21_CONSTEXPR20 void pop_back() noexcept // removes the last element
     {
       --size_array_;
-      (array_ + size_array_)->~T();
+      alloc_traits::destroy(alloc_, array_ + size_array_);
     }
 
-    void swap(s21_vector& other) noexcept // swaps the contents
+    S21_CONSTEXPR20 void swap(s21_vector& other) noexcept // swaps the contents, the allocators only when their traits allow it
     {
+      if constexpr (alloc_traits::propagate_on_container_swap::value) {
+        using std::swap;
+        swap(this->alloc_, other.alloc_);
+      }
+
       value_type * temp_arr = this->array_;
       size_type temp_capacity_array = this->capacity_array_;
       size_type temp_size_array = this->size_array_;
@@ -295,7 +752,7 @@ namespace s21 {
 
 // Element access =============================================================================
 
-    reference at(size_type j) // access specified element with bounds checking
+    S21_CONSTEXPR20 reference at(size_type j) // access specified element with bounds checking
     {
       if (j >= size_array_) {
         throw std::out_of_range("s21_vector::_M_range_check: WTF?!");
@@ -303,7 +760,7 @@ namespace s21 {
       return array_[j];
     }
 
-    const_reference at(size_type j) const //
+    S21_CONSTEXPR20 const_reference at(size_type j) const //
     {
       if (j >= size_array_) {
         throw std::out_of_range("s21_vector::_M_range_check: WTF?!");
@@ -311,113 +768,492 @@ namespace s21 {
       return array_[j];
     }
 
-    reference operator[](size_type j) noexcept // access specified element
+    S21_CONSTEXPR20 reference operator[](size_type j) noexcept // access specified element
     {
       return array_[j];
     }
 
-    const_reference operator[](size_type j) const noexcept // access specified element
+    S21_CONSTEXPR20 const_reference operator[](size_type j) const noexcept // access specified element
     {
       return array_[j];
     }
 
-    reference front() noexcept// access the first element
+    S21_CONSTEXPR20 reference front() noexcept// access the first element
     {
       return array_[0];
     }
 
-    const_reference front() const noexcept// access the first element
+    S21_CONSTEXPR20 const_reference front() const noexcept// access the first element
     {
       return array_[0];
     }
 
-    reference back() noexcept // access the last element
+    S21_CONSTEXPR20 reference back() noexcept // access the last element
     {
       return array_[size_array_ - 1];
     }
 
-    const_reference back() const noexcept // access the last element
+    S21_CONSTEXPR20 const_reference back() const noexcept // access the last element
     {
       return array_[size_array_ - 1];
     }
 
-    value_type * data() noexcept  // direct access to the underlying array
+    S21_CONSTEXPR20 value_type * data() noexcept  // direct access to the underlying array
     {
       return array_;
     }
 
-    const value_type * data() const noexcept  // direct access to the underlying array
+    S21_CONSTEXPR20 const value_type * data() const noexcept  // direct access to the underlying array
     {
       return array_;
     }
 
 // Iterators ====================================================================================
-    class s21_vectorIterator {
+    class s21_vectorIterator {  // contiguous random access iterator
+      friend s21_vectorConstIterator;
+
       public:
-        s21_vectorIterator() : current_(nullptr) {}
-        s21_vectorIterator(value_type * ptr) : current_(ptr) {}
+        using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus > 201703L
+        using iterator_concept = std::contiguous_iterator_tag;
+#endif
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T *;
+        using reference = T &;
 
-        reference operator*() noexcept
-        { 
-          return *current_; 
+        S21_CONSTEXPR20 s21_vectorIterator() : current_(nullptr) {}
+        S21_CONSTEXPR20 s21_vectorIterator(T * ptr) : current_(ptr) {}
+
+        S21_CONSTEXPR20 reference operator*() const noexcept
+        {
+          return *current_;
+        }
+
+        S21_CONSTEXPR20 pointer operator->() const noexcept
+        {
+          return current_;
         }
 
-        iterator &operator++() noexcept  // prefix increment
+        S21_CONSTEXPR20 reference operator[](difference_type n) const noexcept
+        {
+          return current_[n];
+        }
+
+        S21_CONSTEXPR20 iterator &operator++() noexcept  // prefix increment
         {
           ++current_;
           return *this;
         }
 
-        iterator operator++(int) noexcept // postfix increment
+        S21_CONSTEXPR20 iterator operator++(int) noexcept // postfix increment
         {
           iterator temp = *this;
           ++(*this);
           return temp;
         }
 
-        iterator &operator--() noexcept // prefix decrement
+        S21_CONSTEXPR20 iterator &operator--() noexcept // prefix decrement
         {
           --current_;
           return *this;
         }
 
-        iterator operator--(int)  // postfix decrement
+        S21_CONSTEXPR20 iterator operator--(int) noexcept // postfix decrement
         {
           iterator temp = *this;
           --(*this);
           return temp;
         }
 
-        bool operator==(const iterator &other) const noexcept
+        S21_CONSTEXPR20 iterator &operator+=(difference_type n) noexcept
         {
-          return current_ == other.current_;
+          current_ += n;
+          return *this;
         }
 
-        bool operator!=(const iterator &other) const noexcept
+        S21_CONSTEXPR20 iterator &operator-=(difference_type n) noexcept
         {
-            return this->current_ != other.current_;
+          current_ -= n;
+          return *this;
         }
-      
+
+        friend S21_CONSTEXPR20 iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+        friend S21_CONSTEXPR20 iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+        friend S21_CONSTEXPR20 iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+        friend S21_CONSTEXPR20 difference_type operator-(const iterator &a, const iterator &b) noexcept { return a.current_ - b.current_; }
+
+        friend S21_CONSTEXPR20 bool operator==(const iterator &a, const iterator &b) noexcept { return a.current_ == b.current_; }
+        friend S21_CONSTEXPR20 bool operator!=(const iterator &a, const iterator &b) noexcept { return a.current_ != b.current_; }
+        friend S21_CONSTEXPR20 bool operator<(const iterator &a, const iterator &b) noexcept { return a.current_ < b.current_; }
+        friend S21_CONSTEXPR20 bool operator>(const iterator &a, const iterator &b) noexcept { return a.current_ > b.current_; }
+        friend S21_CONSTEXPR20 bool operator<=(const iterator &a, const iterator &b) noexcept { return a.current_ <= b.current_; }
+        friend S21_CONSTEXPR20 bool operator>=(const iterator &a, const iterator &b) noexcept { return a.current_ >= b.current_; }
+
       private:
-        value_type * current_;
+        T * current_;
     };
 
-    iterator begin()  // returns an iterator to the beginning
+    class s21_vectorConstIterator {  // contiguous random access iterator over const elements
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+#if __cplusplus > 201703L
+        using iterator_concept = std::contiguous_iterator_tag;
+#endif
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        S21_CONSTEXPR20 s21_vectorConstIterator() : current_(nullptr) {}
+        S21_CONSTEXPR20 s21_vectorConstIterator(const T * ptr) : current_(ptr) {}
+        S21_CONSTEXPR20 s21_vectorConstIterator(const s21_vectorIterator &other) : current_(other.current_) {}
+
+        S21_CONSTEXPR20 reference operator*() const noexcept
+        {
+          return *current_;
+        }
+
+        S21_CONSTEXPR20 pointer operator->() const noexcept
+        {
+          return current_;
+        }
+
+        S21_CONSTEXPR20 reference operator[](difference_type n) const noexcept
+        {
+          return current_[n];
+        }
+
+        S21_CONSTEXPR20 const_iterator &operator++() noexcept  // prefix increment
+        {
+          ++current_;
+          return *this;
+        }
+
+        S21_CONSTEXPR20 const_iterator operator++(int) noexcept // postfix increment
+        {
+          const_iterator temp = *this;
+          ++(*this);
+          return temp;
+        }
+
+        S21_CONSTEXPR20 const_iterator &operator--() noexcept // prefix decrement
+        {
+          --current_;
+          return *this;
+        }
+
+        S21_CONSTEXPR20 const_iterator operator--(int) noexcept // postfix decrement
+        {
+          const_iterator temp = *this;
+          --(*this);
+          return temp;
+        }
+
+        S21_CONSTEXPR20 const_iterator &operator+=(difference_type n) noexcept
+        {
+          current_ += n;
+          return *this;
+        }
+
+        S21_CONSTEXPR20 const_iterator &operator-=(difference_type n) noexcept
+        {
+          current_ -= n;
+          return *this;
+        }
+
+        friend S21_CONSTEXPR20 const_iterator operator+(const_iterator it, difference_type n) noexcept { return it += n; }
+        friend S21_CONSTEXPR20 const_iterator operator+(difference_type n, const_iterator it) noexcept { return it += n; }
+        friend S21_CONSTEXPR20 const_iterator operator-(const_iterator it, difference_type n) noexcept { return it -= n; }
+        friend S21_CONSTEXPR20 difference_type operator-(const const_iterator &a, const const_iterator &b) noexcept { return a.current_ - b.current_; }
+
+        friend S21_CONSTEXPR20 bool operator==(const const_iterator &a, const const_iterator &b) noexcept { return a.current_ == b.current_; }
+        friend S21_CONSTEXPR20 bool operator!=(const const_iterator &a, const const_iterator &b) noexcept { return a.current_ != b.current_; }
+        friend S21_CONSTEXPR20 bool operator<(const const_iterator &a, const const_iterator &b) noexcept { return a.current_ < b.current_; }
+        friend S21_CONSTEXPR20 bool operator>(const const_iterator &a, const const_iterator &b) noexcept { return a.current_ > b.current_; }
+        friend S21_CONSTEXPR20 bool operator<=(const const_iterator &a, const const_iterator &b) noexcept { return a.current_ <= b.current_; }
+        friend S21_CONSTEXPR20 bool operator>=(const const_iterator &a, const const_iterator &b) noexcept { return a.current_ >= b.current_; }
+
+      private:
+        const T * current_;
+    };
+
+    S21_CONSTEXPR20 iterator begin() noexcept  // returns an iterator to the beginning
     {
-      return s21_vectorIterator(array_);
+      return iterator(array_);
     }
 
-    iterator end()  //returns an iterator to the end
+    S21_CONSTEXPR20 const_iterator begin() const noexcept
     {
-      return s21_vectorIterator(array_ + size_array_);
+      return const_iterator(array_);
+    }
+
+    S21_CONSTEXPR20 iterator end() noexcept  //returns an iterator to the end
+    {
+      return iterator(array_ + size_array_);
+    }
+
+    S21_CONSTEXPR20 const_iterator end() const noexcept
+    {
+      return const_iterator(array_ + size_array_);
+    }
+
+    S21_CONSTEXPR20 const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    S21_CONSTEXPR20 const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+    S21_CONSTEXPR20 reverse_iterator rbegin() noexcept  // returns a reverse iterator to the last element
+    {
+      return reverse_iterator(end());
+    }
+
+    S21_CONSTEXPR20 const_reverse_iterator rbegin() const noexcept
+    {
+      return const_reverse_iterator(end());
+    }
+
+    S21_CONSTEXPR20 reverse_iterator rend() noexcept  // returns a reverse iterator past the first element
+    {
+      return reverse_iterator(begin());
+    }
+
+    S21_CONSTEXPR20 const_reverse_iterator rend() const noexcept
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    S21_CONSTEXPR20 const_reverse_iterator crbegin() const noexcept
+    {
+      return rbegin();
+    }
+
+    S21_CONSTEXPR20 const_reverse_iterator crend() const noexcept
+    {
+      return rend();
     }
 
   private:
+    // the allocator can resize the buffer itself and the elements do not mind moving bytewise
+    static constexpr bool resize_in_place =
+        detail::has_reallocate<Allocator>::value && is_trivially_relocatable<T>::value;
+
+    S21_CONSTEXPR20 value_type *allocate(size_type n)
+    {
+      return n ? alloc_traits::allocate(alloc_, n) : nullptr;
+    }
+
+    S21_CONSTEXPR20 void deallocate(value_type *ptr, size_type n) noexcept // doesn't call the destructor!
+    {
+      if (ptr) {
+        alloc_traits::deallocate(alloc_, ptr, n);
+      }
+    }
+
+    // destroys the elements and gives the buffer back, leaving *this empty
+    S21_CONSTEXPR20 void release() noexcept
+    {
+      if (array_) {
+        note_release();
+        detail::destroy(alloc_, array_, array_ + size_array_);
+        deallocate(array_, capacity_array_);
+      }
+      array_ = nullptr;
+      size_array_ = 0;
+      capacity_array_ = 0;
+    }
+
+    // takes over the buffer of v, whose allocator compares equal to ours; *this must be empty
+    S21_CONSTEXPR20 void steal(s21_vector &v) noexcept
+    {
+      array_ = v.array_;
+      size_array_ = v.size_array_;
+      capacity_array_ = v.capacity_array_;
+
+      v.array_ = nullptr;
+      v.size_array_ = 0;
+      v.capacity_array_ = 0;
+    }
+
+    S21_CONSTEXPR20 void reallocate(size_type new_capacity_array)
+    {
+      if constexpr (resize_in_place) {
+        if (array_ && new_capacity_array) {
+          array_ = alloc_.reallocate(array_, capacity_array_, new_capacity_array);
+          capacity_array_ = new_capacity_array;
+          return;
+        }
+      }
+      value_type *new_array = allocate(new_capacity_array);
+      try {
+        detail::relocate(alloc_, array_, array_ + size_array_, new_array);
+      } catch (...) {
+          deallocate(new_array, new_capacity_array);
+          throw;
+      }
+      replace_buffer(new_array, new_capacity_array);
+    }
+
+    S21_CONSTEXPR20 void replace_buffer(value_type *new_array, size_type new_capacity_array) noexcept
+    {
+      if (array_) {
+        note_release();
+      }
+      deallocate(array_, capacity_array_);
+      array_ = new_array;
+      capacity_array_ = new_capacity_array;
+    }
+
+    S21_CONSTEXPR20 void note_release() noexcept  // tells a watching allocator how much of the buffer is going back unused
+    {
+      if constexpr (detail::has_buffer_hooks<Allocator>::value) {
+        alloc_.on_release(capacity_array_ * sizeof(value_type), size_array_ * sizeof(value_type));
+      }
+    }
+
+    // capacity to grow to for required elements, as the growth policy sees it; capped
+    // at max_size() so that a narrow allocator size_type never wraps around
+    S21_CONSTEXPR20 size_type recommend(std::size_t required) const
+    {
+      size_type limit = max_size();
+      if (required > limit) {
+        throw std::length_error("s21_vector: size exceeds max_size()");
+      }
+      std::size_t grown = GrowthPolicy::grow(capacity_array_, required, sizeof(value_type));
+      return grown < limit ? static_cast<size_type>(grown) : limit;
+    }
+
+    // grows at most once, shifts the tail by k at most once and lets construct fill
+    // the k raw slots at index; construct must clean up after itself if it throws.
+    // k is checked against max_size() before it is narrowed to size_type
+    template <typename Construct>
+    S21_CONSTEXPR20 iterator insert_constructed(size_type index, std::size_t count, Construct construct)
+    {
+      if (count) {
+        if (count > static_cast<std::size_t>(max_size() - size_array_)) {
+          throw std::length_error("s21_vector: size exceeds max_size()");
+        }
+        size_type k = static_cast<size_type>(count);
+        if (size_array_ + k > capacity_array_) {
+          reserve(recommend(std::size_t(size_array_) + k));
+        }
+        open_gap(index, k);
+        try {
+          construct(array_ + index);
+        } catch (...) {
+            close_gap(index, k);
+            throw;
+        }
+        size_array_ += k;
+      }
+      return iterator(array_ + index);
+    }
+
+    // relocates [index, size) up by k, leaving k raw slots at index; capacity must suffice
+    S21_CONSTEXPR20 void open_gap(size_type index, size_type k)
+    {
+      try {
+        detail::relocate_right(alloc_, array_ + index, array_ + size_array_, k);
+      } catch (...) {
+          size_array_ = index;
+          throw;
+      }
+    }
+
+    // undoes open_gap after the new elements failed to construct
+    S21_CONSTEXPR20 void close_gap(size_type index, size_type k) noexcept
+    {
+      try {
+        detail::relocate_left(alloc_, array_ + index + k, array_ + size_array_ + k, k);
+      } catch (...) {
+          size_array_ = index;
+      }
+    }
+
+    [[no_unique_address]] Allocator alloc_;
     T *array_;
     size_type size_array_;
     size_type capacity_array_;
   };
 
+// Non-member functions =========================================================================
+
+  // Erases every element pred accepts in one pass: the survivors are moved down
+  // over the gaps as they are met and the leftover tail is destroyed at the end,
+  // instead of shifting the whole tail once per erased element. Returns how many
+  // elements were erased.
+  template <typename T, typename Allocator, typename GrowthPolicy, typename Predicate>
+  S21_CONSTEXPR20 typename s21_vector<T, Allocator, GrowthPolicy>::size_type erase_if(s21_vector<T, Allocator, GrowthPolicy> &v, Predicate pred)
+  {
+    auto last = std::remove_if(v.begin(), v.end(), pred);
+    auto erased = static_cast<typename s21_vector<T, Allocator, GrowthPolicy>::size_type>(v.end() - last);
+    v.erase(last, v.cend());
+    return erased;
+  }
+
+  template <typename T, typename Allocator, typename GrowthPolicy, typename U>
+  S21_CONSTEXPR20 typename s21_vector<T, Allocator, GrowthPolicy>::size_type erase(s21_vector<T, Allocator, GrowthPolicy> &v, const U &value)  // erases every element equal to value
+  {
+    return erase_if(v, [&value](const auto &element) { return element == value; });
+  }
+
+  // Erases the elements at the given indices, which must be sorted (repeats are
+  // allowed), in one pass like erase_if. The indices are checked before anything
+  // moves, so a bad list throws and leaves v untouched. Returns how many elements
+  // were erased.
+  template <typename T, typename Allocator, typename GrowthPolicy, typename IndexRange>
+  S21_CONSTEXPR20 typename s21_vector<T, Allocator, GrowthPolicy>::size_type erase_indices(s21_vector<T, Allocator, GrowthPolicy> &v, const IndexRange &indices)
+  {
+    using size_type = typename s21_vector<T, Allocator, GrowthPolicy>::size_type;
+    auto first = std::begin(indices);
+    auto last = std::end(indices);
+    if (first == last) {
+      return 0;
+    }
+    for (auto it = first, next = std::next(first); next != last; ++it, ++next) {
+      if (*next < *it) {
+        throw std::invalid_argument("erase_indices: indices are not sorted");
+      }
+    }
+    if constexpr (std::is_signed<std::decay_t<decltype(*first)>>::value) {
+      if (*first < 0) {  // sorted: the first index is the smallest
+        throw std::out_of_range("erase_indices: index out of range");
+      }
+    }
+    size_type size = v.size();
+    if (static_cast<size_type>(*std::prev(last)) >= size) {
+      throw std::out_of_range("erase_indices: index out of range");
+    }
+
+    size_type out = static_cast<size_type>(*first);
+    for (size_type i = out; i != size; ++i) {
+      if (first != last && static_cast<size_type>(*first) == i) {
+        while (first != last && static_cast<size_type>(*first) == i) {
+          ++first;
+        }
+      } else {
+          v[out++] = std::move(v[i]);
+      }
+    }
+    v.erase(v.cbegin() + static_cast<std::ptrdiff_t>(out), v.cend());
+    return size - out;
+  }
+
+  namespace pmr {
+
+    // vector whose buffer comes from a std::pmr::memory_resource, e.g. a per-request monotonic arena
+    template <typename T, typename GrowthPolicy = growth::doubling<>>
+    using vector = s21_vector<T, std::pmr::polymorphic_allocator<T>, GrowthPolicy>;
+
+  }  // namespace pmr
+
 }
 
-#endif  // SRC_S21_VECTOR_H_
\ No newline at end of file
+#include "s21_vector_bool.h"
+
+#endif  // SRC_S21_VECTOR_H_
@@ -0,0 +1,755 @@
+#ifndef SRC_S21_VECTOR_BOOL_H_
+#define SRC_S21_VECTOR_BOOL_H_
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // s21_vector<bool> keeps one bit per element in 64-bit words, like std::vector<bool>:
+  // operator[] and the iterators hand out proxy references instead of bool&, and
+  // data() is the word array. Bits past size() in the last word are always zero, so
+  // count(), find_first()/find_next() and the range operations work a word at a time.
+  // Sizes and capacities are in bits; the growth policy sizes the word buffer.
+  template <typename Allocator, typename GrowthPolicy>
+  class s21_vector<bool, Allocator, GrowthPolicy>
+  {
+  public:
+    using word_type = std::uint64_t;
+
+  private:
+    using word_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<word_type>;
+    using word_traits = std::allocator_traits<word_allocator>;
+
+    static constexpr std::size_t word_bits = 64;
+
+  public:
+    using value_type = bool;
+    using allocator_type = Allocator;
+    using growth_policy = GrowthPolicy;
+    using const_reference = bool;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    class reference;
+    class s21_vectorIterator;
+    class s21_vectorConstIterator;
+    using iterator = s21_vectorIterator;
+    using const_iterator = s21_vectorConstIterator;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    static constexpr size_type npos = static_cast<size_type>(-1);  // what find_first/find_next return when no bit is set
+
+    s21_vector() noexcept(noexcept(Allocator())) : s21_vector(Allocator()) {} // default constructor, creates empty vector
+
+    explicit s21_vector(const Allocator &alloc) noexcept // creates empty vector which will allocate from alloc
+        : alloc_(alloc), array_(nullptr), size_array_(0), capacity_array_(0) {}
+
+    s21_vector(size_type n, const Allocator &alloc = Allocator()) : s21_vector(alloc)  // parameterized constructor, creates n false bits
+    {
+      resize(n);
+    }
+
+    s21_vector(size_type n, bool value, const Allocator &alloc = Allocator()) : s21_vector(alloc)  // creates n copies of value
+    {
+      resize(n, value);
+    }
+
+    s21_vector(std::initializer_list<bool> const &items, const Allocator &alloc = Allocator()) // initializer list constructor
+        : s21_vector(items.begin(), items.end(), alloc) {}
+
+    template <typename InputIt, typename = std::enable_if_t<!std::is_integral<InputIt>::value>>
+    s21_vector(InputIt first, InputIt last, const Allocator &alloc = Allocator()) : s21_vector(alloc) // range constructor, copies [first, last)
+    {
+      if constexpr (detail::is_forward_iterator<InputIt>::value) {
+        reserve(static_cast<size_type>(std::distance(first, last)));
+      }
+      for (; first != last; ++first) {
+        push_back(static_cast<bool>(*first));
+      }
+    }
+
+    s21_vector(const s21_vector &v) // copy constructor
+        : alloc_(word_traits::select_on_container_copy_construction(v.alloc_)), array_(nullptr), size_array_(0), capacity_array_(0)
+    {
+      assign_words(v);
+    }
+
+    s21_vector(s21_vector &&v) noexcept // move constructor, leaves v empty
+        : alloc_(std::move(v.alloc_)), array_(v.array_), size_array_(v.size_array_), capacity_array_(v.capacity_array_)
+    {
+      v.array_ = nullptr;
+      v.size_array_ = 0;
+      v.capacity_array_ = 0;
+    }
+
+    s21_vector &operator=(const s21_vector &v) // copy assignment, propagates the allocator when its traits ask for it
+    {
+      if (this != &v) {
+        if constexpr (word_traits::propagate_on_container_copy_assignment::value) {
+          if (alloc_ != v.alloc_) {
+            release();
+          }
+          alloc_ = v.alloc_;
+        }
+        assign_words(v);
+      }
+      return *this;
+    }
+
+    s21_vector &operator=(s21_vector &&v) noexcept(word_traits::propagate_on_container_move_assignment::value ||
+                                                   word_traits::is_always_equal::value) // assignment operator overload for moving object
+    {
+      if (this != &v) {
+        if constexpr (word_traits::propagate_on_container_move_assignment::value) {
+          release();
+          alloc_ = std::move(v.alloc_);
+          steal(v);
+        } else {
+            if (alloc_ == v.alloc_) {
+              release();
+              steal(v);
+            } else {
+                assign_words(v);
+            }
+        }
+      }
+      return *this;
+    }
+
+    ~s21_vector() noexcept // destructor
+    {
+      release();
+    }
+
+    allocator_type get_allocator() const noexcept  // returns the allocator, rebound back to bool
+    {
+      return allocator_type(alloc_);
+    }
+
+// Capacity =====================================================================================
+    bool empty() const noexcept // checks whether the container is empty
+    {
+      return size_array_ ? false : true;
+    }
+
+    size_type size() const noexcept  // returns the number of bits
+    {
+      return size_array_;
+    }
+
+    size_type max_size() const noexcept // returns the maximum possible number of bits
+    {
+      size_type j = 0;
+      size_type by_size = (j - 1) / 2;
+      size_type by_alloc = word_traits::max_size(alloc_);
+      return by_alloc < by_size / word_bits ? by_alloc * word_bits : by_size;
+    }
+
+    void reserve(size_type new_capacity)  // makes room for new_capacity bits
+    {
+      if (words_for(new_capacity) > capacity_array_) {
+        reallocate(words_for(new_capacity));
+      }
+    }
+
+    void resize(size_type new_size_array, bool value = false)  // new bits are value, or the trailing ones are dropped
+    {
+      if (new_size_array > size_array_) {
+        reserve(new_size_array);
+        size_type used = words_for(size_array_);
+        std::memset(array_ + used, 0, (words_for(new_size_array) - used) * sizeof(word_type));
+        size_type old_size = size_array_;
+        size_array_ = new_size_array;
+        if (value) {
+          fill(old_size, new_size_array, true);
+        }
+      } else {
+          size_array_ = new_size_array;
+          clear_tail();
+      }
+    }
+
+    size_type capacity() const noexcept // returns the number of bits that fit in the allocated words
+    {
+      return capacity_array_ * word_bits;
+    }
+
+    void shrink_to_fit()  // frees the words past the last one in use
+    {
+      if (capacity_array_ > words_for(size_array_)) {
+        reallocate(words_for(size_array_));
+      }
+    }
+
+// Modifiers ====================================================================================
+    void clear() noexcept  // clears the contents
+    {
+      size_array_ = 0;
+    }
+
+    void push_back(bool value)  // adds a bit to the end
+    {
+      if (size_array_ == capacity()) {
+        reallocate(GrowthPolicy::grow(capacity_array_, words_for(size_array_ + 1), sizeof(word_type)));
+      }
+      if (size_array_ % word_bits == 0) {
+        array_[size_array_ / word_bits] = 0;
+      }
+      ++size_array_;
+      (*this)[size_array_ - 1] = value;
+    }
+
+    reference emplace_back(bool value)  // adds a bit to the end and returns a reference to it
+    {
+      push_back(value);
+      return back();
+    }
+
+    void pop_back() noexcept  // removes the last bit
+    {
+      (*this)[--size_array_] = false;
+    }
+
+    void erase(const_iterator pos)  // erases the bit at pos
+    {
+      erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)  // erases [first, last), shifting the later bits down once
+    {
+      size_type from = static_cast<size_type>(first - cbegin());
+      size_type to = static_cast<size_type>(last - cbegin());
+      if (from > to || to > size_array_) {
+        throw std::out_of_range("s21_vector<bool>::erase: invalid range");
+      }
+      for (size_type i = to; i != size_array_; ++i) {
+        (*this)[i - (to - from)] = static_cast<bool>((*this)[i]);
+      }
+      resize(size_array_ - (to - from));
+      return begin() + static_cast<difference_type>(from);
+    }
+
+    void swap(s21_vector &other) noexcept  // swaps the contents and, when its traits ask for it, the allocators
+    {
+      if constexpr (word_traits::propagate_on_container_swap::value) {
+        std::swap(alloc_, other.alloc_);
+      }
+      std::swap(array_, other.array_);
+      std::swap(size_array_, other.size_array_);
+      std::swap(capacity_array_, other.capacity_array_);
+    }
+
+// Bit operations ===============================================================================
+    size_type count() const noexcept  // number of set bits, a popcount per word
+    {
+      size_type n = 0;
+      for (size_type w = 0, used = words_for(size_array_); w != used; ++w) {
+        n += static_cast<size_type>(__builtin_popcountll(array_[w]));
+      }
+      return n;
+    }
+
+    bool any() const noexcept
+    {
+      return find_first() != npos;
+    }
+
+    bool none() const noexcept
+    {
+      return find_first() == npos;
+    }
+
+    bool all() const noexcept
+    {
+      return count() == size_array_;
+    }
+
+    size_type find_first() const noexcept  // index of the first set bit, or npos
+    {
+      return find_from(0);
+    }
+
+    size_type find_next(size_type pos) const noexcept  // index of the first set bit after pos, or npos
+    {
+      return pos + 1 < size_array_ ? find_from(pos + 1) : npos;
+    }
+
+    s21_vector &set() noexcept  // sets every bit
+    {
+      fill(0, size_array_, true);
+      return *this;
+    }
+
+    s21_vector &set(size_type pos, size_type len, bool value = true)  // sets [pos, pos + len) to value, whole words at a time
+    {
+      check_range(pos, len);
+      fill(pos, pos + len, value);
+      return *this;
+    }
+
+    s21_vector &reset() noexcept  // clears every bit
+    {
+      fill(0, size_array_, false);
+      return *this;
+    }
+
+    s21_vector &reset(size_type pos, size_type len)  // clears [pos, pos + len)
+    {
+      return set(pos, len, false);
+    }
+
+    s21_vector &flip() noexcept  // inverts every bit
+    {
+      for (size_type w = 0, used = words_for(size_array_); w != used; ++w) {
+        array_[w] = ~array_[w];
+      }
+      clear_tail();
+      return *this;
+    }
+
+// Element access =============================================================================
+
+    reference at(size_type j) // access specified bit with bounds checking
+    {
+      if (j >= size_array_) {
+        throw std::out_of_range("s21_vector<bool>::at: index out of range");
+      }
+      return (*this)[j];
+    }
+
+    bool at(size_type j) const
+    {
+      if (j >= size_array_) {
+        throw std::out_of_range("s21_vector<bool>::at: index out of range");
+      }
+      return (*this)[j];
+    }
+
+    reference operator[](size_type j) noexcept // access specified bit
+    {
+      return reference(array_ + j / word_bits, word_type(1) << (j % word_bits));
+    }
+
+    bool operator[](size_type j) const noexcept // access specified bit
+    {
+      return (array_[j / word_bits] >> (j % word_bits)) & 1;
+    }
+
+    reference front() noexcept // access the first bit
+    {
+      return (*this)[0];
+    }
+
+    bool front() const noexcept // access the first bit
+    {
+      return (*this)[0];
+    }
+
+    reference back() noexcept // access the last bit
+    {
+      return (*this)[size_array_ - 1];
+    }
+
+    bool back() const noexcept // access the last bit
+    {
+      return (*this)[size_array_ - 1];
+    }
+
+    word_type * data() noexcept  // the words, bit j is bit j % 64 of word j / 64
+    {
+      return array_;
+    }
+
+    const word_type * data() const noexcept
+    {
+      return array_;
+    }
+
+// Iterators ====================================================================================
+    class reference {  // proxy for one bit
+      friend class s21_vector;
+
+      public:
+        reference(const reference &) noexcept = default;
+
+        operator bool() const noexcept
+        {
+          return (*word_ & mask_) != 0;
+        }
+
+        reference &operator=(bool value) noexcept
+        {
+          if (value) {
+            *word_ |= mask_;
+          } else {
+              *word_ &= ~mask_;
+          }
+          return *this;
+        }
+
+        reference &operator=(const reference &other) noexcept  // assigns the bit, not the proxy
+        {
+          return *this = static_cast<bool>(other);
+        }
+
+        bool operator~() const noexcept
+        {
+          return !static_cast<bool>(*this);
+        }
+
+        void flip() noexcept
+        {
+          *word_ ^= mask_;
+        }
+
+      private:
+        reference(word_type *word, word_type mask) noexcept : word_(word), mask_(mask) {}
+
+        word_type *word_;
+        word_type mask_;
+    };
+
+    class s21_vectorIterator {  // random access iterator yielding proxy references
+      friend class s21_vector;
+      friend s21_vectorConstIterator;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = typename s21_vector::reference;
+
+        s21_vectorIterator() : words_(nullptr), index_(0) {}
+
+        reference operator*() const noexcept
+        {
+          return reference(words_ + size_type(index_) / word_bits, word_type(1) << (size_type(index_) % word_bits));
+        }
+
+        reference operator[](difference_type n) const noexcept
+        {
+          return *(*this + n);
+        }
+
+        iterator &operator++() noexcept  // prefix increment
+        {
+          ++index_;
+          return *this;
+        }
+
+        iterator operator++(int) noexcept // postfix increment
+        {
+          iterator temp = *this;
+          ++(*this);
+          return temp;
+        }
+
+        iterator &operator--() noexcept // prefix decrement
+        {
+          --index_;
+          return *this;
+        }
+
+        iterator operator--(int) noexcept // postfix decrement
+        {
+          iterator temp = *this;
+          --(*this);
+          return temp;
+        }
+
+        iterator &operator+=(difference_type n) noexcept
+        {
+          index_ += n;
+          return *this;
+        }
+
+        iterator &operator-=(difference_type n) noexcept
+        {
+          index_ -= n;
+          return *this;
+        }
+
+        friend iterator operator+(iterator it, difference_type n) noexcept { return it += n; }
+        friend iterator operator+(difference_type n, iterator it) noexcept { return it += n; }
+        friend iterator operator-(iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const iterator &a, const iterator &b) noexcept { return a.index_ - b.index_; }
+
+        friend bool operator==(const iterator &a, const iterator &b) noexcept { return a.index_ == b.index_; }
+        friend bool operator!=(const iterator &a, const iterator &b) noexcept { return a.index_ != b.index_; }
+        friend bool operator<(const iterator &a, const iterator &b) noexcept { return a.index_ < b.index_; }
+        friend bool operator>(const iterator &a, const iterator &b) noexcept { return a.index_ > b.index_; }
+        friend bool operator<=(const iterator &a, const iterator &b) noexcept { return a.index_ <= b.index_; }
+        friend bool operator>=(const iterator &a, const iterator &b) noexcept { return a.index_ >= b.index_; }
+
+      private:
+        s21_vectorIterator(word_type *words, difference_type index) : words_(words), index_(index) {}
+
+        word_type *words_;
+        difference_type index_;
+    };
+
+    class s21_vectorConstIterator {  // random access iterator yielding bools
+      friend class s21_vector;
+
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = bool;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = bool;
+
+        s21_vectorConstIterator() : words_(nullptr), index_(0) {}
+        s21_vectorConstIterator(const s21_vectorIterator &other) : words_(other.words_), index_(other.index_) {}
+
+        reference operator*() const noexcept
+        {
+          return (words_[size_type(index_) / word_bits] >> (size_type(index_) % word_bits)) & 1;
+        }
+
+        reference operator[](difference_type n) const noexcept
+        {
+          return *(*this + n);
+        }
+
+        const_iterator &operator++() noexcept  // prefix increment
+        {
+          ++index_;
+          return *this;
+        }
+
+        const_iterator operator++(int) noexcept // postfix increment
+        {
+          const_iterator temp = *this;
+          ++(*this);
+          return temp;
+        }
+
+        const_iterator &operator--() noexcept // prefix decrement
+        {
+          --index_;
+          return *this;
+        }
+
+        const_iterator operator--(int) noexcept // postfix decrement
+        {
+          const_iterator temp = *this;
+          --(*this);
+          return temp;
+        }
+
+        const_iterator &operator+=(difference_type n) noexcept
+        {
+          index_ += n;
+          return *this;
+        }
+
+        const_iterator &operator-=(difference_type n) noexcept
+        {
+          index_ -= n;
+          return *this;
+        }
+
+        friend const_iterator operator+(const_iterator it, difference_type n) noexcept { return it += n; }
+        friend const_iterator operator+(difference_type n, const_iterator it) noexcept { return it += n; }
+        friend const_iterator operator-(const_iterator it, difference_type n) noexcept { return it -= n; }
+        friend difference_type operator-(const const_iterator &a, const const_iterator &b) noexcept { return a.index_ - b.index_; }
+
+        friend bool operator==(const const_iterator &a, const const_iterator &b) noexcept { return a.index_ == b.index_; }
+        friend bool operator!=(const const_iterator &a, const const_iterator &b) noexcept { return a.index_ != b.index_; }
+        friend bool operator<(const const_iterator &a, const const_iterator &b) noexcept { return a.index_ < b.index_; }
+        friend bool operator>(const const_iterator &a, const const_iterator &b) noexcept { return a.index_ > b.index_; }
+        friend bool operator<=(const const_iterator &a, const const_iterator &b) noexcept { return a.index_ <= b.index_; }
+        friend bool operator>=(const const_iterator &a, const const_iterator &b) noexcept { return a.index_ >= b.index_; }
+
+      private:
+        s21_vectorConstIterator(const word_type *words, difference_type index) : words_(words), index_(index) {}
+
+        const word_type *words_;
+        difference_type index_;
+    };
+
+    iterator begin() noexcept  // returns an iterator to the first bit
+    {
+      return iterator(array_, 0);
+    }
+
+    const_iterator begin() const noexcept
+    {
+      return const_iterator(array_, 0);
+    }
+
+    iterator end() noexcept  // returns an iterator past the last bit
+    {
+      return iterator(array_, static_cast<difference_type>(size_array_));
+    }
+
+    const_iterator end() const noexcept
+    {
+      return const_iterator(array_, static_cast<difference_type>(size_array_));
+    }
+
+    const_iterator cbegin() const noexcept
+    {
+      return begin();
+    }
+
+    const_iterator cend() const noexcept
+    {
+      return end();
+    }
+
+    reverse_iterator rbegin() noexcept  // returns a reverse iterator to the last bit
+    {
+      return reverse_iterator(end());
+    }
+
+    const_reverse_iterator rbegin() const noexcept
+    {
+      return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() noexcept  // returns a reverse iterator past the first bit
+    {
+      return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rend() const noexcept
+    {
+      return const_reverse_iterator(begin());
+    }
+
+    const_reverse_iterator crbegin() const noexcept
+    {
+      return rbegin();
+    }
+
+    const_reverse_iterator crend() const noexcept
+    {
+      return rend();
+    }
+
+  private:
+    static size_type words_for(size_type bits) noexcept
+    {
+      return (bits + word_bits - 1) / word_bits;
+    }
+
+    static word_type low_bits(size_type n) noexcept  // a word with the n < 64 lowest bits set
+    {
+      return (word_type(1) << n) - 1;
+    }
+
+    void release() noexcept
+    {
+      if (array_) {
+        word_traits::deallocate(alloc_, array_, capacity_array_);
+      }
+      array_ = nullptr;
+      size_array_ = 0;
+      capacity_array_ = 0;
+    }
+
+    void steal(s21_vector &v) noexcept
+    {
+      array_ = v.array_;
+      size_array_ = v.size_array_;
+      capacity_array_ = v.capacity_array_;
+      v.array_ = nullptr;
+      v.size_array_ = 0;
+      v.capacity_array_ = 0;
+    }
+
+    void assign_words(const s21_vector &v)
+    {
+      size_array_ = 0;
+      reserve(v.size_array_);
+      if (v.size_array_) {
+        std::memcpy(array_, v.array_, words_for(v.size_array_) * sizeof(word_type));
+      }
+      size_array_ = v.size_array_;
+    }
+
+    void reallocate(size_type new_words)  // moves the words in use into a buffer of new_words words
+    {
+      word_type *words = new_words ? word_traits::allocate(alloc_, new_words) : nullptr;
+      if (size_array_) {
+        std::memcpy(words, array_, words_for(size_array_) * sizeof(word_type));
+      }
+      if (array_) {
+        word_traits::deallocate(alloc_, array_, capacity_array_);
+      }
+      array_ = words;
+      capacity_array_ = new_words;
+    }
+
+    void clear_tail() noexcept  // zeroes the bits of the last word past size()
+    {
+      if (size_array_ % word_bits) {
+        array_[size_array_ / word_bits] &= low_bits(size_array_ % word_bits);
+      }
+    }
+
+    void check_range(size_type pos, size_type len) const
+    {
+      if (pos > size_array_ || len > size_array_ - pos) {
+        throw std::out_of_range("s21_vector<bool>: bit range out of range");
+      }
+    }
+
+    void fill(size_type first, size_type last, bool value) noexcept  // [first, last) to value: partial words masked, whole words stored
+    {
+      if (first == last) {
+        return;
+      }
+      size_type first_word = first / word_bits;
+      size_type last_word = (last - 1) / word_bits;
+      word_type head = ~low_bits(first % word_bits);
+      word_type tail = last % word_bits ? low_bits(last % word_bits) : ~word_type(0);
+      if (first_word == last_word) {
+        apply_mask(first_word, head & tail, value);
+        return;
+      }
+      apply_mask(first_word, head, value);
+      for (size_type w = first_word + 1; w != last_word; ++w) {
+        array_[w] = value ? ~word_type(0) : 0;
+      }
+      apply_mask(last_word, tail, value);
+    }
+
+    void apply_mask(size_type w, word_type mask, bool value) noexcept
+    {
+      if (value) {
+        array_[w] |= mask;
+      } else {
+          array_[w] &= ~mask;
+      }
+    }
+
+    size_type find_from(size_type pos) const noexcept  // first set bit at or after pos
+    {
+      if (pos >= size_array_) {
+        return npos;
+      }
+      size_type w = pos / word_bits;
+      size_type used = words_for(size_array_);
+      word_type word = array_[w] & ~low_bits(pos % word_bits);
+      while (!word) {
+        if (++w == used) {
+          return npos;
+        }
+        word = array_[w];
+      }
+      return w * word_bits + static_cast<size_type>(__builtin_ctzll(word));
+    }
+
+    [[no_unique_address]] word_allocator alloc_;
+    word_type *array_;
+    size_type size_array_;      // in bits
+    size_type capacity_array_;  // in words
+  };
+
+}
+
+#endif  // SRC_S21_VECTOR_BOOL_H_
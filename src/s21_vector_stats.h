@@ -0,0 +1,228 @@
+#ifndef SRC_S21_VECTOR_STATS_H_
+#define SRC_S21_VECTOR_STATS_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+  // Counters collected by stats_allocator, for one vector or for every vector of a type
+  struct vector_stats {
+    std::uint64_t allocations = 0;          // buffers allocated
+    std::uint64_t deallocations = 0;        // buffers given back
+    std::uint64_t reallocations = 0;        // buffers replaced: allocated while another one was live, or resized in place
+    std::uint64_t relocated_bytes = 0;      // bytes of elements moved to a new address by growth, insert or erase
+    std::uint64_t constructions = 0;        // elements constructed, relocating moves included; a trivially relocatable T is memcpy'd, which only relocated_bytes sees
+    std::uint64_t destructions = 0;         // destructors run; trivially destructible elements have none
+    std::uint64_t peak_capacity_bytes = 0;  // largest buffer allocated
+    std::uint64_t wasted_bytes = 0;         // capacity still unused when buffers were given back
+    std::uint64_t unused_bytes = 0;         // capacity unused right now; only filled in by stats(v)
+  };
+
+  // Allocator that counts what an s21_vector does with its memory. Using it is
+  // the opt-in: s21_vector only calls its hooks when the allocator has them, so
+  // vectors with any other allocator compile to exactly what they did before.
+  // Each vector has its own counters, which follow the buffer on move and swap
+  // and start from zero in a copy; every event is also added to totals() of
+  // the element type, which is thread safe. Everything else is done by Base.
+  template <typename T, typename Base = std::allocator<T>>
+  class stats_allocator : public Base
+  {
+    using base_traits = std::allocator_traits<Base>;
+
+    template <typename U, typename B>
+    friend class stats_allocator;
+
+  public:
+    using value_type = T;
+    using size_type = typename base_traits::size_type;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+    using is_always_equal = typename base_traits::is_always_equal;
+
+    template <typename U>
+    struct rebind {
+      using other = stats_allocator<U, typename base_traits::template rebind_alloc<U>>;
+    };
+
+    stats_allocator() = default;
+
+    explicit stats_allocator(const Base &base) : Base(base) {}
+
+    template <typename U, typename B>
+    stats_allocator(const stats_allocator<U, B> &other) : Base(static_cast<const B&>(other)) {}  // rebinding starts new counters
+
+    stats_allocator(const stats_allocator &other) = default;
+
+    stats_allocator(stats_allocator &&other) noexcept : Base(std::move(other)), stats_(other.stats_), live_(other.live_)  // the counters go with the buffer
+    {
+      other.stats_ = vector_stats();
+      other.live_ = 0;
+    }
+
+    stats_allocator &operator=(const stats_allocator &other) = default;
+
+    stats_allocator &operator=(stats_allocator &&other) noexcept
+    {
+      if (this != &other) {
+        Base::operator=(std::move(other));
+        stats_ = other.stats_;
+        live_ = other.live_;
+        other.stats_ = vector_stats();
+        other.live_ = 0;
+      }
+      return *this;
+    }
+
+    stats_allocator select_on_container_copy_construction() const  // a copied vector counts from zero
+    {
+      return stats_allocator(base_traits::select_on_container_copy_construction(*this));
+    }
+
+    T *allocate(size_type n)
+    {
+      T *ptr = base_traits::allocate(*this, n);
+      std::uint64_t bytes = static_cast<std::uint64_t>(n) * sizeof(T);
+      add(&vector_stats::allocations, &shared_stats::allocations, 1);
+      if (live_++) {
+        add(&vector_stats::reallocations, &shared_stats::reallocations, 1);
+      }
+      if (bytes > stats_.peak_capacity_bytes) {
+        stats_.peak_capacity_bytes = bytes;
+      }
+      std::uint64_t peak = shared().peak_capacity_bytes.load(std::memory_order_relaxed);
+      while (bytes > peak && !shared().peak_capacity_bytes.compare_exchange_weak(peak, bytes, std::memory_order_relaxed)) {
+      }
+      return ptr;
+    }
+
+    void deallocate(T *ptr, size_type n) noexcept
+    {
+      base_traits::deallocate(*this, ptr, n);
+      add(&vector_stats::deallocations, &shared_stats::deallocations, 1);
+      if (live_) {
+        --live_;
+      }
+    }
+
+    template <typename B = Base, typename = decltype(std::declval<B&>().reallocate(std::declval<T*>(), size_type(), size_type()))>
+    T *reallocate(T *ptr, size_type old_n, size_type new_n)  // offered only when Base can resize in place
+    {
+      T *result = Base::reallocate(ptr, old_n, new_n);
+      add(&vector_stats::reallocations, &shared_stats::reallocations, 1);
+      std::uint64_t bytes = static_cast<std::uint64_t>(new_n) * sizeof(T);
+      if (bytes > stats_.peak_capacity_bytes) {
+        stats_.peak_capacity_bytes = bytes;
+      }
+      return result;
+    }
+
+    template <typename U, typename... Args>
+    void construct(U *ptr, Args&&... args)
+    {
+      base_traits::construct(*this, ptr, std::forward<Args>(args)...);
+      add(&vector_stats::constructions, &shared_stats::constructions, 1);
+    }
+
+    template <typename U>
+    void destroy(U *ptr) noexcept
+    {
+      base_traits::destroy(*this, ptr);
+      add(&vector_stats::destructions, &shared_stats::destructions, 1);
+    }
+
+    void on_relocate(std::size_t bytes) noexcept  // s21_vector hook
+    {
+      add(&vector_stats::relocated_bytes, &shared_stats::relocated_bytes, bytes);
+    }
+
+    void on_release(std::size_t capacity_bytes, std::size_t used_bytes) noexcept  // s21_vector hook
+    {
+      add(&vector_stats::wasted_bytes, &shared_stats::wasted_bytes, capacity_bytes - used_bytes);
+    }
+
+    const vector_stats &stats() const noexcept { return stats_; }  // the counters of the vector owning this allocator
+
+    static vector_stats totals() noexcept  // the counters summed over every vector of T since the last reset_totals()
+    {
+      vector_stats total;
+      shared_stats &s = shared();
+      total.allocations = s.allocations.load(std::memory_order_relaxed);
+      total.deallocations = s.deallocations.load(std::memory_order_relaxed);
+      total.reallocations = s.reallocations.load(std::memory_order_relaxed);
+      total.relocated_bytes = s.relocated_bytes.load(std::memory_order_relaxed);
+      total.constructions = s.constructions.load(std::memory_order_relaxed);
+      total.destructions = s.destructions.load(std::memory_order_relaxed);
+      total.peak_capacity_bytes = s.peak_capacity_bytes.load(std::memory_order_relaxed);
+      total.wasted_bytes = s.wasted_bytes.load(std::memory_order_relaxed);
+      return total;
+    }
+
+    static void reset_totals() noexcept
+    {
+      shared_stats &s = shared();
+      for (std::atomic<std::uint64_t> *counter : {&s.allocations, &s.deallocations, &s.reallocations, &s.relocated_bytes,
+                                                  &s.constructions, &s.destructions, &s.peak_capacity_bytes, &s.wasted_bytes}) {
+        counter->store(0, std::memory_order_relaxed);
+      }
+    }
+
+    template <typename U, typename B>
+    bool operator==(const stats_allocator<U, B> &other) const noexcept
+    {
+      return static_cast<const Base&>(*this) == static_cast<const B&>(other);
+    }
+
+    template <typename U, typename B>
+    bool operator!=(const stats_allocator<U, B> &other) const noexcept
+    {
+      return !(*this == other);
+    }
+
+  private:
+    struct shared_stats {
+      std::atomic<std::uint64_t> allocations{0};
+      std::atomic<std::uint64_t> deallocations{0};
+      std::atomic<std::uint64_t> reallocations{0};
+      std::atomic<std::uint64_t> relocated_bytes{0};
+      std::atomic<std::uint64_t> constructions{0};
+      std::atomic<std::uint64_t> destructions{0};
+      std::atomic<std::uint64_t> peak_capacity_bytes{0};
+      std::atomic<std::uint64_t> wasted_bytes{0};
+    };
+
+    static shared_stats &shared() noexcept
+    {
+      static shared_stats s;
+      return s;
+    }
+
+    void add(std::uint64_t vector_stats::*mine, std::atomic<std::uint64_t> shared_stats::*all, std::uint64_t n) noexcept
+    {
+      stats_.*mine += n;
+      (shared().*all).fetch_add(n, std::memory_order_relaxed);
+    }
+
+    vector_stats stats_;
+    std::size_t live_ = 0;  // buffers allocated and not yet given back
+  };
+
+  // s21_vector that keeps stats_allocator counters
+  template <typename T, typename GrowthPolicy = growth::doubling<>>
+  using instrumented_vector = s21_vector<T, stats_allocator<T>, GrowthPolicy>;
+
+  // The counters of one vector, with unused_bytes set to its current spare capacity
+  template <typename T, typename Base, typename GrowthPolicy>
+  vector_stats stats(const s21_vector<T, stats_allocator<T, Base>, GrowthPolicy> &v)
+  {
+    vector_stats result = v.get_allocator().stats();
+    result.unused_bytes = static_cast<std::uint64_t>(v.capacity() - v.size()) * sizeof(T);
+    return result;
+  }
+
+}
+
+#endif  // SRC_S21_VECTOR_STATS_H_